@@ -1,137 +1,301 @@
-﻿#include "lexer.h"
-#include "parse.h"
-#include "runtime.h"
-#include "statement.h"
-#include "test_runner_p.h"
-
+﻿#include "async_output.h"
+#include "heap_snapshot.h"
+#include "interpreter.h"
+#include "server.h"
+
+#include <algorithm>
+#include <charconv>
+#include <csignal>
+#include <fstream>
 #include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <chrono>
+#include <thread>
+#else
+#include <pthread.h>
+#endif
 
 using namespace std;
 
-namespace parse {
-    void RunOpenLexerTests(TestRunner& tr);
-}  // namespace parse
-
-namespace ast {
-    void RunUnitTests(TestRunner& tr);
-}
-namespace runtime {
-    void RunObjectHolderTests(TestRunner& tr);
-    void RunObjectsTests(TestRunner& tr);
-}  // namespace runtime
-
-void TestParseProgram(TestRunner& tr);
-
 namespace {
 
-    void RunMythonProgram(istream& input, ostream& output) {
-        parse::Lexer lexer(input);
-        auto program = ParseProgram(lexer);
-
-        runtime::SimpleContext context{ output };
-        runtime::Closure closure;
-        program->Execute(closure, context);
+    struct Options {
+        // Пустая строка или "-" означает стандартный поток
+        string input_path;
+        string output_path;
+        MethodParsing method_parsing = MethodParsing::Eager;
+        bool buffered_output = false;
+        // Путь к сокету, если интерпретатор запущен как сервер
+        string serve_path;
+        // Ограничение памяти программы в байтах
+        size_t memory_limit = runtime::MemoryAccount::UNLIMITED;
+        bool memory_stats = false;
+        // Файл, в который записывается снимок кучи после выполнения программы
+        string heap_snapshot_path;
+        // Снимок, который нужно проанализировать вместо выполнения программы
+        string analyze_heap_path;
+        bool help = false;
+    };
+
+    void PrintUsage(ostream& out) {
+        out << "Usage: Mython [-i|--input <file>] [-o|--output <file>] [--lazy-methods] [--buffered-output]\n"sv
+            << "              [--memory-limit <bytes>] [--memory-stats] [--heap-snapshot <file>]\n"sv
+            << "       Mython --analyze-heap <file>\n"sv
+            << "       Mython --serve <socket> [--lazy-methods] [--memory-limit <bytes>]\n"sv
+            << "  -i, --input <file>   read the program from file instead of stdin\n"sv
+            << "  -o, --output <file>  write the program output to file instead of stdout\n"sv
+            << "  --lazy-methods       parse method bodies on their first call\n"sv
+            << "  --buffered-output    write the output from a background thread in large blocks\n"sv
+            << "  --memory-limit <bytes>  abort the program when its objects and variables take more memory\n"sv
+            << "  --memory-stats       print memory usage of the program to stderr when it finishes\n"sv
+            << "  --heap-snapshot <file>  write the objects reachable from globals to file when the program finishes\n"sv
+            << "  --analyze-heap <file>   print the largest retainers from a heap snapshot\n"sv
+            << "  --serve <socket>     run as a server accepting programs over a Unix domain socket\n"sv
+            << "  -h, --help           show this help\n"sv;
     }
 
-    void TestSimplePrints() {
-        istringstream input(R"(
-print 57
-print 10, 24, -8
-print 'hello'
-print "world"
-print True, False
-print
-print None
-)");
-
-        ostringstream output;
-        RunMythonProgram(input, output);
-
-        ASSERT_EQUAL(output.str(), "57\n10 24 -8\nhello\nworld\nTrue False\n\nNone\n");
+    optional<size_t> ParseSize(string_view text) {
+        size_t value = 0;
+        const auto result = from_chars(text.data(), text.data() + text.size(), value);
+        if (result.ec != errc() || result.ptr != text.data() + text.size()) {
+            return nullopt;
+        }
+        return value;
     }
 
-    void TestAssignments() {
-        istringstream input(R"(
-x = 57
-print x
-x = 'C++ black belt'
-print x
-y = False
-x = y
-print x
-x = None
-print x, y
-)");
-
-        ostringstream output;
-        RunMythonProgram(input, output);
-
-        ASSERT_EQUAL(output.str(), "57\nC++ black belt\nFalse\nNone False\n");
+    optional<Options> ParseOptions(int argc, char** argv) {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            const string_view arg = argv[i];
+            if ((arg == "-i"sv || arg == "--input"sv) && i + 1 < argc) {
+                options.input_path = argv[++i];
+            }
+            else if ((arg == "-o"sv || arg == "--output"sv) && i + 1 < argc) {
+                options.output_path = argv[++i];
+            }
+            else if (arg == "--lazy-methods"sv) {
+                options.method_parsing = MethodParsing::Lazy;
+            }
+            else if (arg == "--buffered-output"sv) {
+                options.buffered_output = true;
+            }
+            else if (arg == "--memory-limit"sv && i + 1 < argc) {
+                const auto limit = ParseSize(argv[++i]);
+                if (!limit) {
+                    cerr << "Invalid memory limit: "sv << argv[i] << endl;
+                    return nullopt;
+                }
+                options.memory_limit = *limit;
+            }
+            else if (arg == "--memory-stats"sv) {
+                options.memory_stats = true;
+            }
+            else if (arg == "--heap-snapshot"sv && i + 1 < argc) {
+                options.heap_snapshot_path = argv[++i];
+            }
+            else if (arg == "--analyze-heap"sv && i + 1 < argc) {
+                options.analyze_heap_path = argv[++i];
+            }
+            else if (arg == "--serve"sv && i + 1 < argc) {
+                options.serve_path = argv[++i];
+            }
+            else if (arg == "-h"sv || arg == "--help"sv) {
+                options.help = true;
+            }
+            else {
+                cerr << "Unknown option: "sv << arg << endl;
+                return nullopt;
+            }
+        }
+        return options;
     }
 
-    void TestArithmetics() {
-        istringstream input("print 1+2+3+4+5, 1*2*3*4*5, 1-2-3-4-5, 36/4/3, 2*5+10/2");
-
-        ostringstream output;
-        RunMythonProgram(input, output);
-
-        ASSERT_EQUAL(output.str(), "15 120 -13 3 15\n");
+    bool IsStandardStream(const string& path) {
+        return path.empty() || path == "-"s;
     }
 
-    void TestVariablesArePointers() {
-        istringstream input(R"(
-class Counter:
-  def __init__():
-    self.value = 0
-
-  def add():
-    self.value = self.value + 1
-
-class Dummy:
-  def do_add(counter):
-    counter.add()
+    using ClassStats = vector<pair<string, runtime::SlabStats>>;
+
+    // Статистика размещения экземпляров классов, объявленных в глобальной области
+    ClassStats CollectClassStats(const runtime::Closure& globals) {
+        ClassStats result;
+        for (const auto& [name, value] : globals) {
+            if (const auto* cls = value.TryAs<runtime::Class>()) {
+                result.emplace_back(cls->GetName(), cls->GetInstanceStats());
+            }
+        }
+        sort(result.begin(), result.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        });
+        return result;
+    }
 
-x = Counter()
-y = x
+    void PrintMemoryStats(ostream& out, const runtime::MemoryStats& stats, const ClassStats& class_stats) {
+        out << "memory: peak "sv << stats.peak_bytes << " bytes, live "sv << stats.live_bytes << " bytes, "sv
+            << stats.allocations << " allocations\n"sv;
+        for (size_t i = 0; i < runtime::MEMORY_KIND_COUNT; ++i) {
+            const auto kind = static_cast<runtime::MemoryKind>(i);
+            if (stats[kind].allocations != 0) {
+                out << "  "sv << runtime::GetMemoryKindName(kind) << ": "sv << stats[kind].allocations
+                    << " allocations, live "sv << stats[kind].live_bytes << " bytes\n"sv;
+            }
+        }
+        for (const auto& [name, instances] : class_stats) {
+            if (instances.allocations != 0) {
+                out << "  instances of "sv << name << ": "sv << instances.allocations << " allocations, "sv
+                    << instances.occupied_slots << " slots of "sv << instances.slot_size << " bytes occupied in "sv
+                    << instances.slabs << " slabs\n"sv;
+            }
+        }
+    }
 
-x.add()
-y.add()
+#ifdef _WIN32
+    volatile sig_atomic_t stop_requested = 0;
 
-print x.value
+    extern "C" void RequestStop(int) {
+        stop_requested = 1;
+    }
 
-d = Dummy()
-d.do_add(x)
+    // Перехватывает SIGINT и SIGTERM, которых затем ждёт WaitForStopSignal
+    void InterceptStopSignals() {
+        signal(SIGINT, RequestStop);
+        signal(SIGTERM, RequestStop);
+    }
 
-print y.value
-)");
+    void WaitForStopSignal() {
+        while (!stop_requested) {
+            this_thread::sleep_for(chrono::milliseconds(100));
+        }
+    }
+#else
+    sigset_t GetStopSignals() {
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGINT);
+        sigaddset(&signals, SIGTERM);
+        return signals;
+    }
 
-        ostringstream output;
-        RunMythonProgram(input, output);
+    // Блокирует SIGINT и SIGTERM в текущем потоке. Потоки, запущенные после этого, наследуют маску,
+    // поэтому сигналы достаются только WaitForStopSignal
+    void InterceptStopSignals() {
+        const sigset_t signals = GetStopSignals();
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    }
 
-        ASSERT_EQUAL(output.str(), "2\n3\n");
+    void WaitForStopSignal() {
+        const sigset_t signals = GetStopSignals();
+        int received = 0;
+        sigwait(&signals, &received);
     }
+#endif
 
-    void TestAll() {
-        TestRunner tr;
-        parse::RunOpenLexerTests(tr);
-        runtime::RunObjectHolderTests(tr);
-        runtime::RunObjectsTests(tr);
-        ast::RunUnitTests(tr);
-        TestParseProgram(tr);
+}  // namespace
 
-        RUN_TEST(tr, TestSimplePrints);
-        RUN_TEST(tr, TestAssignments);
-        RUN_TEST(tr, TestArithmetics);
-        RUN_TEST(tr, TestVariablesArePointers);
+int main(int argc, char** argv) {
+    const auto options = ParseOptions(argc, argv);
+    if (!options) {
+        PrintUsage(cerr);
+        return 2;
+    }
+    if (options->help) {
+        PrintUsage(cout);
+        return 0;
     }
 
-}  // namespace
+    // Вывод программы не перемежается с stdio, поэтому синхронизация не нужна
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
 
-int main() {
     try {
-        TestAll();
-
-        RunMythonProgram(cin, cout);
+        if (!options->analyze_heap_path.empty()) {
+            ifstream snapshot_file(options->analyze_heap_path, ios::binary);
+            if (!snapshot_file) {
+                cerr << "Can't open heap snapshot "sv << options->analyze_heap_path << endl;
+                return 1;
+            }
+            runtime::PrintHeapReport(cout, runtime::HeapSnapshot::Read(snapshot_file));
+            return 0;
+        }
+
+        if (!options->serve_path.empty()) {
+            server::ServerOptions server_options;
+            server_options.method_parsing = options->method_parsing;
+            server_options.memory_limit = options->memory_limit;
+            InterceptStopSignals();
+            server::Server server(options->serve_path, server_options);
+            server.Start();
+            cerr << "Listening on "sv << options->serve_path << endl;
+            WaitForStopSignal();
+            // Stop разрывает открытые соединения, дожидается потоков и удаляет файл сокета
+            server.Stop();
+            cerr << "Stopped"sv << endl;
+            return 0;
+        }
+
+        ifstream input_file;
+        if (!IsStandardStream(options->input_path)) {
+            input_file.open(options->input_path);
+            if (!input_file) {
+                cerr << "Can't open input file "sv << options->input_path << endl;
+                return 1;
+            }
+        }
+        ofstream output_file;
+        if (!IsStandardStream(options->output_path)) {
+            output_file.open(options->output_path);
+            if (!output_file) {
+                cerr << "Can't open output file "sv << options->output_path << endl;
+                return 1;
+            }
+        }
+
+        shared_ptr<runtime::MemoryAccount> memory;
+        if (options->memory_stats || options->memory_limit != runtime::MemoryAccount::UNLIMITED) {
+            memory = make_shared<runtime::MemoryAccount>(options->memory_limit);
+        }
+        const runtime::MemoryAccount::Scope memory_scope(memory);
+
+        ClassStats class_stats;
+        GlobalsInspector inspect_globals;
+        if (!options->heap_snapshot_path.empty() || options->memory_stats) {
+            inspect_globals = [&options, &class_stats](const runtime::Closure& globals) {
+                if (const string& path = options->heap_snapshot_path; !path.empty()) {
+                    ofstream snapshot_file(path, ios::binary);
+                    runtime::HeapSnapshot::Take(globals).Write(snapshot_file);
+                    if (!snapshot_file) {
+                        throw runtime_error("Can't write heap snapshot "s + path);
+                    }
+                }
+                if (options->memory_stats) {
+                    class_stats = CollectClassStats(globals);
+                }
+            };
+        }
+
+        istream& input = input_file.is_open() ? static_cast<istream&>(input_file) : cin;
+        ostream& output = output_file.is_open() ? static_cast<ostream&>(output_file) : cout;
+        if (options->buffered_output) {
+            runtime::AsyncWriter writer(output);
+            runtime::BufferedContext context(writer);
+            RunMythonProgram(input, context, options->method_parsing, inspect_globals);
+            context.Flush();
+        }
+        else {
+            runtime::SimpleContext context{ output };
+            RunMythonProgram(input, context, options->method_parsing, inspect_globals);
+            output.flush();
+        }
+        if (options->memory_stats) {
+            PrintMemoryStats(cerr, memory->GetStats(), class_stats);
+        }
     }
     catch (const std::exception& e) {
         std::cerr << e.what() << std::endl;
@@ -0,0 +1,216 @@
+#include "async_output.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+namespace runtime {
+
+    namespace {
+        //        
+        const size_t MAX_FREE_BUFFERS = 16;
+    }  // namespace
+
+    AsyncWriter::AsyncWriter(ostream& sink)
+        : sink_(sink)
+        , thread_([this]() {
+            Run();
+        }) {
+    }
+
+    AsyncWriter::~AsyncWriter() {
+        {
+            lock_guard guard(mutex_);
+            stopping_ = true;
+        }
+        has_work_.notify_one();
+        thread_.join();
+        sink_.flush();
+    }
+
+    void AsyncWriter::Submit(string buffer) {
+        if (buffer.empty()) {
+            return;
+        }
+        {
+            lock_guard guard(mutex_);
+            queue_.push_back(std::move(buffer));
+        }
+        has_work_.notify_one();
+    }
+
+    string AsyncWriter::AcquireBuffer(size_t capacity) {
+        string buffer;
+        {
+            lock_guard guard(mutex_);
+            if (!free_buffers_.empty()) {
+                buffer = std::move(free_buffers_.back());
+                free_buffers_.pop_back();
+            }
+        }
+        buffer.clear();
+        buffer.reserve(capacity);
+        return buffer;
+    }
+
+    void AsyncWriter::Flush() {
+        unique_lock lock(mutex_);
+        idle_.wait(lock, [this]() {
+            return queue_.empty() && !writing_;
+        });
+        sink_.flush();
+        if (failed_ || !sink_) {
+            failed_ = false;
+            throw runtime_error("Failed to write program output"s);
+        }
+    }
+
+    void AsyncWriter::Run() {
+        unique_lock lock(mutex_);
+        while (true) {
+            has_work_.wait(lock, [this]() {
+                return stopping_ || !queue_.empty();
+            });
+            if (queue_.empty()) {
+                return;
+            }
+            string buffer = std::move(queue_.front());
+            queue_.pop_front();
+            writing_ = true;
+
+            lock.unlock();
+            sink_.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+            const bool ok = static_cast<bool>(sink_);
+            lock.lock();
+
+            failed_ = failed_ || !ok;
+            writing_ = false;
+            if (free_buffers_.size() < MAX_FREE_BUFFERS) {
+                free_buffers_.push_back(std::move(buffer));
+            }
+            if (queue_.empty()) {
+                idle_.notify_all();
+            }
+        }
+    }
+
+    BufferedContext::OutputBuffer::OutputBuffer(AsyncWriter& writer, BufferedOutputOptions options)
+        : writer_(writer)
+        , options_(options) {
+        options_.buffer_size = max<size_t>(options_.buffer_size, 1);
+        ResetBuffer(writer_.AcquireBuffer(options_.buffer_size), 0);
+    }
+
+    void BufferedContext::OutputBuffer::ResetBuffer(string buffer, size_t used) {
+        buffer_ = std::move(buffer);
+        buffer_.resize(max(buffer_.capacity(), options_.buffer_size));
+        char* begin = buffer_.data();
+        setp(begin, begin + buffer_.size());
+        pbump(static_cast<int>(used));
+    }
+
+    void BufferedContext::OutputBuffer::HandOverAll() {
+        const size_t used = pptr() - pbase();
+        if (used == 0) {
+            return;
+        }
+        buffer_.resize(used);
+        writer_.Submit(std::move(buffer_));
+        ResetBuffer(writer_.AcquireBuffer(options_.buffer_size), 0);
+    }
+
+    void BufferedContext::OutputBuffer::HandOver() {
+        const size_t used = pptr() - pbase();
+        if (options_.ordering == OutputOrdering::Bytes) {
+            HandOverAll();
+            return;
+        }
+
+        const char* last_newline = nullptr;
+        for (const char* p = pptr(); p != pbase(); --p) {
+            if (p[-1] == '\n') {
+                last_newline = p - 1;
+                break;
+            }
+        }
+        if (last_newline == nullptr) {
+            //   :  ,    
+            if (used == buffer_.size()) {
+                string bigger = writer_.AcquireBuffer(buffer_.size() * 2);
+                bigger.assign(pbase(), used);
+                ResetBuffer(std::move(bigger), used);
+            }
+            return;
+        }
+
+        const size_t complete = last_newline - pbase() + 1;
+        string next = writer_.AcquireBuffer(options_.buffer_size);
+        next.assign(pbase() + complete, used - complete);
+        buffer_.resize(complete);
+        writer_.Submit(std::move(buffer_));
+        ResetBuffer(std::move(next), used - complete);
+    }
+
+    BufferedContext::OutputBuffer::int_type BufferedContext::OutputBuffer::overflow(int_type ch) {
+        if (traits_type::eq_int_type(ch, traits_type::eof())) {
+            return traits_type::not_eof(ch);
+        }
+        if (pptr() == epptr()) {
+            HandOver();
+        }
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+        if (options_.flush_policy == FlushPolicy::EveryLine && traits_type::to_char_type(ch) == '\n') {
+            HandOver();
+        }
+        return ch;
+    }
+
+    streamsize BufferedContext::OutputBuffer::xsputn(const char* s, streamsize count) {
+        streamsize written = 0;
+        while (written < count) {
+            if (pptr() == epptr()) {
+                HandOver();
+            }
+            const streamsize chunk = min<streamsize>(count - written, epptr() - pptr());
+            memcpy(pptr(), s + written, static_cast<size_t>(chunk));
+            pbump(static_cast<int>(chunk));
+            written += chunk;
+        }
+        if (options_.flush_policy == FlushPolicy::EveryLine && memchr(s, '\n', static_cast<size_t>(count)) != nullptr) {
+            HandOver();
+        }
+        return written;
+    }
+
+    int BufferedContext::OutputBuffer::sync() {
+        HandOverAll();
+        return 0;
+    }
+
+    BufferedContext::BufferedContext(AsyncWriter& writer, BufferedOutputOptions options)
+        : buffer_(writer, options)
+        , stream_(&buffer_)
+        , writer_(writer) {
+    }
+
+    BufferedContext::~BufferedContext() {
+        buffer_.HandOverAll();
+    }
+
+    ostream& BufferedContext::GetOutputStream() {
+        return stream_;
+    }
+
+    void BufferedContext::Write(string_view text) {
+        buffer_.sputn(text.data(), static_cast<streamsize>(text.size()));
+    }
+
+    void BufferedContext::Flush() {
+        buffer_.HandOverAll();
+        writer_.Flush();
+    }
+
+}  // namespace runtime
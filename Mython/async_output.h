@@ -0,0 +1,119 @@
+#pragma once
+
+#include "runtime.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace runtime {
+
+    //  ,       sink    .
+    //       BufferedContext
+    class AsyncWriter {
+    public:
+        explicit AsyncWriter(std::ostream& sink);
+        //        
+        ~AsyncWriter();
+
+        AsyncWriter(const AsyncWriter&) = delete;
+        AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+        //      
+        void Submit(std::string buffer);
+
+        //       capacity,   -   
+        std::string AcquireBuffer(size_t capacity);
+
+        // ,      ,   sink.
+        //  runtime_error,    sink  
+        void Flush();
+
+    private:
+        void Run();
+
+        std::ostream& sink_;
+        std::mutex mutex_;
+        std::condition_variable has_work_;
+        std::condition_variable idle_;
+        std::deque<std::string> queue_;
+        std::vector<std::string> free_buffers_;
+        bool writing_ = false;
+        bool stopping_ = false;
+        bool failed_ = false;
+        std::thread thread_;
+    };
+
+    //      
+    enum class FlushPolicy {
+        //    ,    Flush   
+        WhenFull,
+        //    ,     
+        EveryLine,
+    };
+
+    //       
+    enum class OutputOrdering {
+        //     
+        Bytes,
+        //     ,    ,
+        //  ,    
+        Lines,
+    };
+
+    struct BufferedOutputOptions {
+        size_t buffer_size = 64 * 1024;
+        FlushPolicy flush_policy = FlushPolicy::WhenFull;
+        OutputOrdering ordering = OutputOrdering::Lines;
+    };
+
+    // ,   print       
+    //  .      
+    class BufferedContext : public Context {
+    public:
+        explicit BufferedContext(AsyncWriter& writer, BufferedOutputOptions options = {});
+        //    ,    
+        ~BufferedContext();
+
+        std::ostream& GetOutputStream() override;
+        //     ,  ostream
+        void Write(std::string_view text) override;
+
+        //         
+        void Flush();
+
+    private:
+        class OutputBuffer : public std::streambuf {
+        public:
+            OutputBuffer(AsyncWriter& writer, BufferedOutputOptions options);
+
+            //     ,   
+            void HandOverAll();
+
+        protected:
+            int_type overflow(int_type ch) override;
+            std::streamsize xsputn(const char* s, std::streamsize count) override;
+            int sync() override;
+
+        private:
+            //       OutputOrdering
+            void HandOver();
+            void ResetBuffer(std::string buffer, size_t used);
+
+            AsyncWriter& writer_;
+            BufferedOutputOptions options_;
+            std::string buffer_;
+        };
+
+        OutputBuffer buffer_;
+        std::ostream stream_;
+        AsyncWriter& writer_;
+    };
+
+}  // namespace runtime
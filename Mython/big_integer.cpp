@@ -0,0 +1,291 @@
+#include "big_integer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <ostream>
+
+using namespace std;
+
+namespace runtime {
+
+    namespace {
+
+        constexpr uint64_t DIGIT_BASE = uint64_t{ 1 } << 32;
+
+        //      
+        int CountLeadingZeros(uint32_t digit) {
+            int count = 0;
+            while ((digit & 0x80000000u) == 0) {
+                digit <<= 1;
+                ++count;
+            }
+            return count;
+        }
+
+    }  // namespace
+
+    BigInteger::BigInteger(int64_t value)
+        : negative_(value < 0) {
+        //     ,      
+        uint64_t magnitude = negative_ ? uint64_t{ 0 } - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+        while (magnitude != 0) {
+            digits_.push_back(static_cast<uint32_t>(magnitude));
+            magnitude >>= 32;
+        }
+    }
+
+    BigInteger::BigInteger(bool negative, Digits digits)
+        : negative_(negative)
+        , digits_(move(digits)) {
+        Trim(digits_);
+        if (digits_.empty()) {
+            negative_ = false;
+        }
+    }
+
+    bool BigInteger::FitsInt64() const {
+        if (digits_.size() > 2) {
+            return false;
+        }
+        uint64_t magnitude = 0;
+        for (size_t i = digits_.size(); i > 0; --i) {
+            magnitude = (magnitude << 32) | digits_[i - 1];
+        }
+        const uint64_t limit = static_cast<uint64_t>(numeric_limits<int64_t>::max());
+        return negative_ ? magnitude <= limit + 1 : magnitude <= limit;
+    }
+
+    int64_t BigInteger::ToInt64() const {
+        assert(FitsInt64());
+        uint64_t magnitude = 0;
+        for (size_t i = digits_.size(); i > 0; --i) {
+            magnitude = (magnitude << 32) | digits_[i - 1];
+        }
+        return static_cast<int64_t>(negative_ ? uint64_t{ 0 } - magnitude : magnitude);
+    }
+
+    double BigInteger::ToDouble() const {
+        double result = 0.0;
+        for (size_t i = digits_.size(); i > 0; --i) {
+            result = result * static_cast<double>(DIGIT_BASE) + digits_[i - 1];
+        }
+        return negative_ ? -result : result;
+    }
+
+    string BigInteger::ToString() const {
+        if (digits_.empty()) {
+            return "0"s;
+        }
+        //        
+        constexpr uint32_t CHUNK = 1000000000;
+        Digits rest = digits_;
+        string result;
+        while (!rest.empty()) {
+            uint32_t chunk = DivideBySmall(rest, CHUNK);
+            for (int i = 0; i < 9 && (chunk != 0 || !rest.empty()); ++i) {
+                result.push_back(static_cast<char>('0' + chunk % 10));
+                chunk /= 10;
+            }
+        }
+        if (negative_) {
+            result.push_back('-');
+        }
+        reverse(result.begin(), result.end());
+        return result;
+    }
+
+    BigInteger operator+(const BigInteger& lhs, const BigInteger& rhs) {
+        if (lhs.negative_ == rhs.negative_) {
+            return { lhs.negative_, BigInteger::AddMagnitudes(lhs.digits_, rhs.digits_) };
+        }
+        //  :     ,    
+        if (BigInteger::CompareMagnitudes(lhs.digits_, rhs.digits_) >= 0) {
+            return { lhs.negative_, BigInteger::SubtractMagnitudes(lhs.digits_, rhs.digits_) };
+        }
+        return { rhs.negative_, BigInteger::SubtractMagnitudes(rhs.digits_, lhs.digits_) };
+    }
+
+    BigInteger operator-(const BigInteger& lhs, const BigInteger& rhs) {
+        if (lhs.negative_ != rhs.negative_) {
+            return { lhs.negative_, BigInteger::AddMagnitudes(lhs.digits_, rhs.digits_) };
+        }
+        if (BigInteger::CompareMagnitudes(lhs.digits_, rhs.digits_) >= 0) {
+            return { lhs.negative_, BigInteger::SubtractMagnitudes(lhs.digits_, rhs.digits_) };
+        }
+        return { !lhs.negative_, BigInteger::SubtractMagnitudes(rhs.digits_, lhs.digits_) };
+    }
+
+    BigInteger operator*(const BigInteger& lhs, const BigInteger& rhs) {
+        return { lhs.negative_ != rhs.negative_, BigInteger::MultiplyMagnitudes(lhs.digits_, rhs.digits_) };
+    }
+
+    BigInteger operator/(const BigInteger& lhs, const BigInteger& rhs) {
+        assert(!rhs.IsZero());
+        return { lhs.negative_ != rhs.negative_, BigInteger::DivideMagnitudes(lhs.digits_, rhs.digits_) };
+    }
+
+    bool operator==(const BigInteger& lhs, const BigInteger& rhs) {
+        return lhs.negative_ == rhs.negative_ && lhs.digits_ == rhs.digits_;
+    }
+
+    bool operator<(const BigInteger& lhs, const BigInteger& rhs) {
+        if (lhs.negative_ != rhs.negative_) {
+            return lhs.negative_;
+        }
+        const int comparison = BigInteger::CompareMagnitudes(lhs.digits_, rhs.digits_);
+        return lhs.negative_ ? comparison > 0 : comparison < 0;
+    }
+
+    ostream& operator<<(ostream& os, const BigInteger& value) {
+        return os << value.ToString();
+    }
+
+    int BigInteger::CompareMagnitudes(const Digits& lhs, const Digits& rhs) {
+        if (lhs.size() != rhs.size()) {
+            return lhs.size() < rhs.size() ? -1 : 1;
+        }
+        for (size_t i = lhs.size(); i > 0; --i) {
+            if (lhs[i - 1] != rhs[i - 1]) {
+                return lhs[i - 1] < rhs[i - 1] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    BigInteger::Digits BigInteger::AddMagnitudes(const Digits& lhs, const Digits& rhs) {
+        const Digits& longer = lhs.size() >= rhs.size() ? lhs : rhs;
+        const Digits& shorter = lhs.size() >= rhs.size() ? rhs : lhs;
+        Digits result;
+        result.reserve(longer.size() + 1);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < longer.size(); ++i) {
+            const uint64_t sum = uint64_t{ longer[i] } + (i < shorter.size() ? shorter[i] : 0) + carry;
+            result.push_back(static_cast<uint32_t>(sum));
+            carry = sum >> 32;
+        }
+        if (carry != 0) {
+            result.push_back(static_cast<uint32_t>(carry));
+        }
+        return result;
+    }
+
+    BigInteger::Digits BigInteger::SubtractMagnitudes(const Digits& lhs, const Digits& rhs) {
+        Digits result;
+        result.reserve(lhs.size());
+        int64_t borrow = 0;
+        for (size_t i = 0; i < lhs.size(); ++i) {
+            int64_t difference = int64_t{ lhs[i] } - (i < rhs.size() ? rhs[i] : 0) - borrow;
+            borrow = difference < 0 ? 1 : 0;
+            result.push_back(static_cast<uint32_t>(difference + borrow * static_cast<int64_t>(DIGIT_BASE)));
+        }
+        Trim(result);
+        return result;
+    }
+
+    BigInteger::Digits BigInteger::MultiplyMagnitudes(const Digits& lhs, const Digits& rhs) {
+        if (lhs.empty() || rhs.empty()) {
+            return {};
+        }
+        Digits result(lhs.size() + rhs.size(), 0);
+        for (size_t i = 0; i < lhs.size(); ++i) {
+            uint64_t carry = 0;
+            for (size_t j = 0; j < rhs.size(); ++j) {
+                const uint64_t product = uint64_t{ lhs[i] } * rhs[j] + result[i + j] + carry;
+                result[i + j] = static_cast<uint32_t>(product);
+                carry = product >> 32;
+            }
+            result[i + rhs.size()] = static_cast<uint32_t>(carry);
+        }
+        Trim(result);
+        return result;
+    }
+
+    uint32_t BigInteger::DivideBySmall(Digits& digits, uint32_t divisor) {
+        uint64_t remainder = 0;
+        for (size_t i = digits.size(); i > 0; --i) {
+            const uint64_t current = (remainder << 32) | digits[i - 1];
+            digits[i - 1] = static_cast<uint32_t>(current / divisor);
+            remainder = current % divisor;
+        }
+        Trim(digits);
+        return static_cast<uint32_t>(remainder);
+    }
+
+    //     D    ,  2, 4.3.1
+    BigInteger::Digits BigInteger::DivideMagnitudes(const Digits& lhs, const Digits& rhs) {
+        if (CompareMagnitudes(lhs, rhs) < 0) {
+            return {};
+        }
+        if (rhs.size() == 1) {
+            Digits quotient = lhs;
+            DivideBySmall(quotient, rhs[0]);
+            return quotient;
+        }
+
+        // :      ,    
+        //      
+        const size_t n = rhs.size();
+        const size_t m = lhs.size() - n;
+        const int shift = CountLeadingZeros(rhs.back());
+        Digits divisor(n);
+        Digits dividend(lhs.size() + 1);
+        for (size_t i = n; i > 0; --i) {
+            const uint64_t wide = (uint64_t{ rhs[i - 1] } << 32 | (i > 1 ? rhs[i - 2] : 0)) << shift;
+            divisor[i - 1] = static_cast<uint32_t>(wide >> 32);
+        }
+        for (size_t i = lhs.size(); i > 0; --i) {
+            const uint64_t wide = (uint64_t{ lhs[i - 1] } << 32 | (i > 1 ? lhs[i - 2] : 0)) << shift;
+            dividend[i - 1] = static_cast<uint32_t>(wide >> 32);
+        }
+        dividend[lhs.size()] = static_cast<uint32_t>((uint64_t{ lhs.back() } << shift) >> 32);
+
+        Digits quotient(m + 1, 0);
+        for (size_t j = m + 1; j > 0; --j) {
+            const size_t k = j - 1;
+            const uint64_t top = uint64_t{ dividend[k + n] } << 32 | dividend[k + n - 1];
+            uint64_t estimate = top / divisor[n - 1];
+            uint64_t remainder = top % divisor[n - 1];
+            while (estimate >= DIGIT_BASE
+                   || estimate * divisor[n - 2] > (remainder << 32 | dividend[k + n - 2])) {
+                --estimate;
+                remainder += divisor[n - 1];
+                if (remainder >= DIGIT_BASE) {
+                    break;
+                }
+            }
+
+            //  estimate * divisor    
+            int64_t borrow = 0;
+            for (size_t i = 0; i < n; ++i) {
+                const uint64_t product = estimate * divisor[i];
+                const int64_t difference = int64_t{ dividend[i + k] } - borrow - static_cast<int64_t>(product & 0xFFFFFFFFu);
+                dividend[i + k] = static_cast<uint32_t>(difference);
+                borrow = static_cast<int64_t>(product >> 32) - (difference >> 32);
+            }
+            const int64_t difference = int64_t{ dividend[k + n] } - borrow;
+            dividend[k + n] = static_cast<uint32_t>(difference);
+
+            //     :   
+            if (difference < 0) {
+                --estimate;
+                uint64_t carry = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    const uint64_t sum = uint64_t{ dividend[i + k] } + divisor[i] + carry;
+                    dividend[i + k] = static_cast<uint32_t>(sum);
+                    carry = sum >> 32;
+                }
+                dividend[k + n] = static_cast<uint32_t>(dividend[k + n] + carry);
+            }
+            quotient[k] = static_cast<uint32_t>(estimate);
+        }
+        Trim(quotient);
+        return quotient;
+    }
+
+    void BigInteger::Trim(Digits& digits) {
+        while (!digits.empty() && digits.back() == 0) {
+            digits.pop_back();
+        }
+    }
+
+}  // namespace runtime
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace runtime {
+
+    //   :      32- ,   .
+    //     ,       
+    class BigInteger {
+    public:
+        BigInteger() = default;
+        explicit BigInteger(std::int64_t value);
+
+        [[nodiscard]] bool IsZero() const {
+            return digits_.empty();
+        }
+
+        [[nodiscard]] bool IsNegative() const {
+            return negative_;
+        }
+
+        //  true,     std::int64_t
+        [[nodiscard]] bool FitsInt64() const;
+        [[nodiscard]] std::int64_t ToInt64() const;
+        //  double;    double - 
+        [[nodiscard]] double ToDouble() const;
+
+        [[nodiscard]] std::string ToString() const;
+
+        [[nodiscard]] size_t GetHeapBytes() const {
+            return digits_.capacity() * sizeof(std::uint32_t);
+        }
+
+        friend BigInteger operator+(const BigInteger& lhs, const BigInteger& rhs);
+        friend BigInteger operator-(const BigInteger& lhs, const BigInteger& rhs);
+        friend BigInteger operator*(const BigInteger& lhs, const BigInteger& rhs);
+        //     ,    .    
+        friend BigInteger operator/(const BigInteger& lhs, const BigInteger& rhs);
+
+        friend bool operator==(const BigInteger& lhs, const BigInteger& rhs);
+        friend bool operator<(const BigInteger& lhs, const BigInteger& rhs);
+
+    private:
+        using Digits = std::vector<std::uint32_t>;
+
+        static int CompareMagnitudes(const Digits& lhs, const Digits& rhs);
+        static Digits AddMagnitudes(const Digits& lhs, const Digits& rhs);
+        //     rhs  lhs
+        static Digits SubtractMagnitudes(const Digits& lhs, const Digits& rhs);
+        static Digits MultiplyMagnitudes(const Digits& lhs, const Digits& rhs);
+        static Digits DivideMagnitudes(const Digits& lhs, const Digits& rhs);
+        //          
+        static std::uint32_t DivideBySmall(Digits& digits, std::uint32_t divisor);
+        static void Trim(Digits& digits);
+
+        BigInteger(bool negative, Digits digits);
+
+        bool negative_ = false;
+        Digits digits_;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const BigInteger& value);
+
+    //   std::int64_t   .  false,  
+    //  ;  *result     
+    [[nodiscard]] inline bool CheckedAdd(std::int64_t lhs, std::int64_t rhs, std::int64_t* result) {
+#if defined(__GNUC__) || defined(__clang__)
+        return !__builtin_add_overflow(lhs, rhs, result);
+#else
+        if ((rhs > 0 && lhs > std::numeric_limits<std::int64_t>::max() - rhs)
+            || (rhs < 0 && lhs < std::numeric_limits<std::int64_t>::min() - rhs)) {
+            return false;
+        }
+        *result = lhs + rhs;
+        return true;
+#endif
+    }
+
+    [[nodiscard]] inline bool CheckedSubtract(std::int64_t lhs, std::int64_t rhs, std::int64_t* result) {
+#if defined(__GNUC__) || defined(__clang__)
+        return !__builtin_sub_overflow(lhs, rhs, result);
+#else
+        if ((rhs < 0 && lhs > std::numeric_limits<std::int64_t>::max() + rhs)
+            || (rhs > 0 && lhs < std::numeric_limits<std::int64_t>::min() + rhs)) {
+            return false;
+        }
+        *result = lhs - rhs;
+        return true;
+#endif
+    }
+
+    [[nodiscard]] inline bool CheckedMultiply(std::int64_t lhs, std::int64_t rhs, std::int64_t* result) {
+#if defined(__GNUC__) || defined(__clang__)
+        return !__builtin_mul_overflow(lhs, rhs, result);
+#else
+        constexpr std::int64_t MAX = std::numeric_limits<std::int64_t>::max();
+        constexpr std::int64_t MIN = std::numeric_limits<std::int64_t>::min();
+        if (lhs != 0 && rhs != 0) {
+            if (lhs > 0 ? (rhs > 0 ? lhs > MAX / rhs : rhs < MIN / lhs)
+                        : (rhs > 0 ? lhs < MIN / rhs : lhs < MAX / rhs)) {
+                return false;
+            }
+        }
+        *result = lhs * rhs;
+        return true;
+#endif
+    }
+
+    //    - MIN / -1.    
+    [[nodiscard]] inline bool CheckedDivide(std::int64_t lhs, std::int64_t rhs, std::int64_t* result) {
+        if (lhs == std::numeric_limits<std::int64_t>::min() && rhs == -1) {
+            return false;
+        }
+        *result = lhs / rhs;
+        return true;
+    }
+
+}  // namespace runtime
@@ -0,0 +1,179 @@
+#include "cycle_collector.h"
+
+#include "dict.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+using namespace std;
+
+namespace runtime {
+
+    namespace {
+
+        // true,         
+        bool SameOwner(const weak_ptr<Object>& lhs, const weak_ptr<Object>& rhs) {
+            return !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
+        }
+
+        //  :  ,   
+        struct Node {
+            ClassInstance* instance;
+            List* list;
+            Dict* dict;
+            const weak_ptr<Object>* owner;
+            //  ,      
+            long external_refs;
+            bool reachable = false;
+        };
+
+        size_t EstimateSize(const Node& node) {
+            if (node.instance != nullptr) {
+                return sizeof(ClassInstance) + node.instance->Fields().GetHeapBytes();
+            }
+            if (node.list != nullptr) {
+                return sizeof(List) + node.list->GetHeapBytes();
+            }
+            return sizeof(Dict) + node.dict->GetHeapBytes();
+        }
+
+        //  visit      ,       
+        template <typename Visitor>
+        void ForEachReference(const Node& node, Visitor visit) {
+            if (node.instance != nullptr) {
+                for (const auto& [name, value] : node.instance->Fields()) {
+                    visit(value);
+                }
+            } else if (node.list != nullptr) {
+                for (const auto& value : node.list->GetObjects()) {
+                    visit(value);
+                }
+            } else {
+                for (const auto& entry : node.dict->GetEntries()) {
+                    visit(entry.key);
+                    visit(entry.value);
+                }
+            }
+        }
+
+    }  // namespace
+
+    CycleCollector::CycleCollector(size_t allocation_threshold)
+        : threshold_(max<size_t>(allocation_threshold, 1))
+        , base_threshold_(threshold_) {
+    }
+
+    CycleCollector::~CycleCollector() {
+        Collect();
+    }
+
+    void CycleCollector::Track(const ObjectHolder& object) {
+        tracked_.push_back(object.GetWeakPtr());
+        if (++allocations_since_collect_ >= threshold_) {
+            Collect();
+        }
+    }
+
+    size_t CycleCollector::Collect() {
+        const auto start = chrono::steady_clock::now();
+        allocations_since_collect_ = 0;
+
+        tracked_.erase(remove_if(tracked_.begin(), tracked_.end(), [](const weak_ptr<Object>& object) {
+            return object.expired();
+        }), tracked_.end());
+
+        unordered_map<const Object*, Node> nodes;
+        nodes.reserve(tracked_.size());
+        for (const auto& object : tracked_) {
+            //     ,       
+            Object* ptr = object.lock().get();
+            if (auto* instance = dynamic_cast<ClassInstance*>(ptr)) {
+                nodes.emplace(ptr, Node{ instance, nullptr, nullptr, &object, object.use_count() });
+            } else if (auto* list = dynamic_cast<List*>(ptr)) {
+                nodes.emplace(ptr, Node{ nullptr, list, nullptr, &object, object.use_count() });
+            } else if (auto* dict = dynamic_cast<Dict*>(ptr)) {
+                nodes.emplace(ptr, Node{ nullptr, nullptr, dict, &object, object.use_count() });
+            }
+        }
+
+        //  :        
+        for (auto& [ptr, node] : nodes) {
+            ForEachReference(node, [&nodes](const ObjectHolder& value) {
+                auto it = nodes.find(value.Get());
+                if (it != nodes.end() && SameOwner(value.GetWeakPtr(), *it->second.owner)) {
+                    --it->second.external_refs;
+                }
+            });
+        }
+
+        // ,       , 
+        vector<Node*> stack;
+        for (auto& [ptr, node] : nodes) {
+            if (node.external_refs > 0 && !node.reachable) {
+                node.reachable = true;
+                stack.push_back(&node);
+            }
+            while (!stack.empty()) {
+                Node* current = stack.back();
+                stack.pop_back();
+                ForEachReference(*current, [&nodes, &stack](const ObjectHolder& value) {
+                    auto it = nodes.find(value.Get());
+                    if (it != nodes.end() && !it->second.reachable) {
+                        it->second.reachable = true;
+                        stack.push_back(&it->second);
+                    }
+                });
+            }
+        }
+
+        //  ,   ,   ,      
+        vector<shared_ptr<Object>> garbage;
+        vector<Node*> garbage_nodes;
+        size_t reclaimed_bytes = 0;
+        for (auto& [ptr, node] : nodes) {
+            if (!node.reachable) {
+                garbage.push_back(node.owner->lock());
+                garbage_nodes.push_back(&node);
+                reclaimed_bytes += EstimateSize(node);
+            }
+        }
+        for (const Node* node : garbage_nodes) {
+            if (node->instance != nullptr) {
+                FieldMap fields;
+                //       ,     
+                fields.swap(node->instance->Fields());
+            } else if (node->list != nullptr) {
+                node->list->Clear();
+            } else {
+                node->dict->Clear();
+            }
+        }
+        const size_t reclaimed = garbage.size();
+        garbage.clear();
+
+        tracked_.erase(remove_if(tracked_.begin(), tracked_.end(), [](const weak_ptr<Object>& object) {
+            return object.expired();
+        }), tracked_.end());
+        //     ,   ,   
+        //     
+        threshold_ = max(base_threshold_, tracked_.size());
+
+        const auto pause = chrono::steady_clock::now() - start;
+        ++stats_.collections;
+        stats_.reclaimed_objects += reclaimed;
+        stats_.reclaimed_bytes += reclaimed_bytes;
+        stats_.total_pause += pause;
+        stats_.max_pause = max(stats_.max_pause, pause);
+        stats_.last_pause = pause;
+        return reclaimed;
+    }
+
+    const CycleCollectorStats& CycleCollector::GetStats() const {
+        return stats_;
+    }
+
+    size_t CycleCollector::GetTrackedCount() const {
+        return tracked_.size();
+    }
+
+}  // namespace runtime
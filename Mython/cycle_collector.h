@@ -0,0 +1,60 @@
+#pragma once
+
+#include "runtime.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace runtime {
+
+    struct CycleCollectorStats {
+        using Duration = std::chrono::steady_clock::duration;
+
+        size_t collections = 0;
+        size_t reclaimed_objects = 0;
+        //    :  ,      
+        size_t reclaimed_bytes = 0;
+        Duration total_pause{};
+        Duration max_pause{};
+        Duration last_pause{};
+    };
+
+    //         .
+    // ObjectHolder    shared_ptr,  ,      
+    //    (node.next = other, other.prev = node),   .  
+    //            ,   
+    //     . ,      ,
+    //  ,   ,    .   - :  
+    //    ,  .
+    //     allocation_threshold     .
+    //         
+    class CycleCollector {
+    public:
+        explicit CycleCollector(size_t allocation_threshold = 10000);
+        //  ,   
+        ~CycleCollector();
+
+        CycleCollector(const CycleCollector&) = delete;
+        CycleCollector& operator=(const CycleCollector&) = delete;
+
+        //    ,         
+        void Track(const ObjectHolder& object);
+
+        //   .    
+        size_t Collect();
+
+        [[nodiscard]] const CycleCollectorStats& GetStats() const;
+        //   ,   ,      
+        [[nodiscard]] size_t GetTrackedCount() const;
+
+    private:
+        size_t threshold_;
+        size_t base_threshold_;
+        size_t allocations_since_collect_ = 0;
+        std::vector<std::weak_ptr<Object>> tracked_;
+        CycleCollectorStats stats_;
+    };
+
+}  // namespace runtime
@@ -0,0 +1,444 @@
+#include "dict.h"
+
+#include "cycle_collector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <typeinfo>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define MYTHON_DICT_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+namespace runtime {
+
+    namespace {
+
+        constexpr int8_t EMPTY = -128;
+        constexpr int8_t DELETED = -2;
+        constexpr uint64_t NONE_HASH = 0x6E6F6E65;
+
+        const string HASH_METHOD = "__hash__"s;
+        const string EQ_METHOD = "__eq__"s;
+
+        //    splitmix64:    ,    
+        //     
+        uint64_t Mix(uint64_t value) {
+            value ^= value >> 30;
+            value *= 0xBF58476D1CE4E5B9u;
+            value ^= value >> 27;
+            value *= 0x94D049BB133111EBu;
+            return value ^ (value >> 31);
+        }
+
+        uint64_t HashDouble(double value) {
+            //     Number,  1  1.0    
+            if (value >= -0x1p63 && value < 0x1p63 && std::trunc(value) == value) {
+                return Mix(static_cast<uint64_t>(static_cast<int64_t>(value)));
+            }
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return Mix(bits);
+        }
+
+        //    ,     value
+        uint32_t MatchGroup(const int8_t* group, int8_t value) {
+#ifdef MYTHON_DICT_SSE2
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value))));
+#else
+            uint32_t mask = 0;
+            for (size_t i = 0; i < Dict::GROUP_SIZE; ++i) {
+                mask |= static_cast<uint32_t>(group[i] == value) << i;
+            }
+            return mask;
+#endif
+        }
+
+        //      
+        size_t LowestBit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctz(mask));
+#elif defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return index;
+#else
+            size_t index = 0;
+            while ((mask & 1) == 0) {
+                mask >>= 1;
+                ++index;
+            }
+            return index;
+#endif
+        }
+
+        //    : typeid  dynamic_cast,       
+        template <typename T>
+        const T* TryAsExactly(const ObjectHolder& object) {
+            const Object* ptr = object.Get();
+            return ptr != nullptr && typeid(*ptr) == typeid(T) ? static_cast<const T*>(ptr) : nullptr;
+        }
+
+        bool IsNumeric(const ObjectHolder& object) {
+            return object.TryAs<Number>() != nullptr || object.TryAs<Float>() != nullptr
+                || object.TryAs<BigNumber>() != nullptr;
+        }
+
+        //    ,   size      
+        size_t GetCapacityFor(size_t size) {
+            size_t capacity = Dict::GROUP_SIZE;
+            while (size * 16 > capacity * 7) {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+    }  // namespace
+
+    Dict::Dict(const Dict& other)
+        : Object(other)
+        , entries_(other.entries_)
+        , capacity_(other.capacity_)
+        , size_(other.size_) {
+        ChargeStorage(GetHeapBytes());
+        if (capacity_ != 0) {
+            control_ = make_unique<int8_t[]>(capacity_);
+            slots_ = make_unique<uint32_t[]>(capacity_);
+            copy_n(other.control_.get(), capacity_, control_.get());
+            copy_n(other.slots_.get(), capacity_, slots_.get());
+        }
+    }
+
+    uint64_t Dict::Hash(const ObjectHolder& key, Context& context) {
+        if (!key) {
+            return NONE_HASH;
+        }
+        if (const auto* num = TryAsExactly<Number>(key)) {
+            // Number  Float   double,  ,    double ,
+            //   double
+            constexpr int64_t EXACT_LIMIT = int64_t{ 1 } << 53;
+            const int64_t value = num->GetValue();
+            if (value < -EXACT_LIMIT || value > EXACT_LIMIT) {
+                return HashDouble(static_cast<double>(value));
+            }
+            return Mix(static_cast<uint64_t>(value));
+        }
+        if (const auto* str = TryAsExactly<String>(key)) {
+            return Mix(std::hash<string_view>{}(str->GetValue()));
+        }
+        if (const auto* num = key.TryAs<Float>()) {
+            return HashDouble(num->GetValue());
+        }
+        //       Float,    double
+        if (const auto* num = key.TryAs<BigNumber>()) {
+            return HashDouble(num->GetValue().ToDouble());
+        }
+        if (const auto* boolean = key.TryAs<Bool>()) {
+            return Mix(boolean->GetValue() ? 1 : 0);
+        }
+        if (key.TryAs<List>() != nullptr || key.TryAs<Dict>() != nullptr) {
+            throw runtime_error("Unhashable dict key"s);
+        }
+        if (IsHashedByIdentity(key)) {
+            return IdentityHash(key);
+        }
+        const ObjectHolder result = key.TryAs<ClassInstance>()->Call(HASH_METHOD, {}, context);
+        if (result.TryAs<ClassInstance>() != nullptr) {
+            throw runtime_error("__hash__ must return a number or a string"s);
+        }
+        return Hash(result, context);
+    }
+
+    bool Dict::IsHashedByIdentity(const ObjectHolder& key) {
+        if (!key || key.TryAs<String>() != nullptr || IsNumeric(key) || key.TryAs<Bool>() != nullptr) {
+            return false;
+        }
+        const auto* instance = key.TryAs<ClassInstance>();
+        return instance == nullptr || !instance->HasMethod(HASH_METHOD, 0);
+    }
+
+    uint64_t Dict::IdentityHash(const ObjectHolder& key) {
+        return Mix(reinterpret_cast<uintptr_t>(key.Get()));
+    }
+
+    bool Dict::KeysEqual(const ObjectHolder& lhs, const ObjectHolder& rhs, Context& context) {
+        if (lhs.Get() == rhs.Get()) {
+            return true;
+        }
+        if (!lhs || !rhs) {
+            return false;
+        }
+        //  :  -     
+        if (const auto* l = TryAsExactly<Number>(lhs)) {
+            if (const auto* r = TryAsExactly<Number>(rhs)) {
+                return l->GetValue() == r->GetValue();
+            }
+        }
+        if (const auto* l = TryAsExactly<String>(lhs)) {
+            if (const auto* r = TryAsExactly<String>(rhs)) {
+                return l->GetValue() == r->GetValue();
+            }
+        }
+        if (const auto* l = lhs.TryAs<String>()) {
+            const auto* r = rhs.TryAs<String>();
+            return r != nullptr && l->GetValue() == r->GetValue();
+        }
+        if (IsNumeric(lhs)) {
+            return IsNumeric(rhs) && Equal(lhs, rhs, context);
+        }
+        if (const auto* l = lhs.TryAs<Bool>()) {
+            const auto* r = rhs.TryAs<Bool>();
+            return r != nullptr && l->GetValue() == r->GetValue();
+        }
+        if (const auto* instance = lhs.TryAs<ClassInstance>(); instance != nullptr && instance->HasMethod(EQ_METHOD, 1)) {
+            //    ,      
+            const ObjectHolder self = lhs;
+            const ObjectHolder other = rhs;
+            return Equal(self, other, context);
+        }
+        return false;
+    }
+
+    size_t Dict::FindSlot(const ObjectHolder& key, uint64_t hash, Context& context) const {
+        if (capacity_ == 0) {
+            return NOT_FOUND;
+        }
+        const auto fingerprint = static_cast<int8_t>(hash & 0x7F);
+        const size_t group_mask = capacity_ / GROUP_SIZE - 1;
+        size_t group = (hash >> 7) & group_mask;
+        //    :   ,   ,    
+        for (size_t step = 1;; ++step) {
+            const size_t base = group * GROUP_SIZE;
+            const int8_t* control = control_.get() + base;
+            for (uint32_t mask = MatchGroup(control, fingerprint); mask != 0; mask &= mask - 1) {
+                const size_t slot = base + LowestBit(mask);
+                const Entry& entry = entries_[slots_[slot]];
+                if (entry.hash != hash) {
+                    continue;
+                }
+                const uint64_t version = version_;
+                const bool equal = KeysEqual(entry.key, key, context);
+                if (version != version_) {
+                    return FindSlot(key, hash, context);
+                }
+                if (equal) {
+                    return slot;
+                }
+            }
+            if (MatchGroup(control, EMPTY) != 0) {
+                return NOT_FOUND;
+            }
+            group = (group + step) & group_mask;
+        }
+    }
+
+    void Dict::InsertIndex(uint64_t hash, uint32_t entry) {
+        const size_t group_mask = capacity_ / GROUP_SIZE - 1;
+        size_t group = (hash >> 7) & group_mask;
+        for (size_t step = 1;; ++step) {
+            const size_t base = group * GROUP_SIZE;
+            if (const uint32_t mask = MatchGroup(control_.get() + base, EMPTY); mask != 0) {
+                const size_t slot = base + LowestBit(mask);
+                control_[slot] = static_cast<int8_t>(hash & 0x7F);
+                slots_[slot] = entry;
+                return;
+            }
+            group = (group + step) & group_mask;
+        }
+    }
+
+    void Dict::Rehash(size_t capacity) {
+        ChargeStorage(entries_.capacity() * sizeof(Entry) + (capacity_ + capacity) * (sizeof(uint32_t) + 1));
+        auto control = make_unique<int8_t[]>(capacity);
+        auto slots = make_unique<uint32_t[]>(capacity);
+        fill_n(control.get(), capacity, EMPTY);
+        if (size_ != entries_.size()) {
+            entries_.erase(remove_if(entries_.begin(), entries_.end(), [](const Entry& entry) {
+                return entry.erased;
+            }), entries_.end());
+        }
+        control_ = std::move(control);
+        slots_ = std::move(slots);
+        capacity_ = capacity;
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            InsertIndex(entries_[i].hash, static_cast<uint32_t>(i));
+        }
+        ++version_;
+    }
+
+    void Dict::ChargeStorage(size_t bytes) {
+        if (bytes > charged_bytes_) {
+            storage_charge_.Add(bytes - charged_bytes_);
+            charged_bytes_ = bytes;
+        }
+    }
+
+    ObjectHolder* Dict::Find(const ObjectHolder& key, Context& context) {
+        const size_t slot = FindSlot(key, Hash(key, context), context);
+        return slot == NOT_FOUND ? nullptr : &entries_[slots_[slot]].value;
+    }
+
+    ObjectHolder Dict::Get(const ObjectHolder& key, Context& context) {
+        if (const ObjectHolder* value = Find(key, context)) {
+            return *value;
+        }
+        throw runtime_error("Key not found"s);
+    }
+
+    void Dict::Set(ObjectHolder key, ObjectHolder value, Context& context) {
+        const uint64_t hash = Hash(key, context);
+        if (const size_t slot = FindSlot(key, hash, context); slot != NOT_FOUND) {
+            entries_[slots_[slot]].value = std::move(value);
+            return;
+        }
+        if ((entries_.size() + 1) * 8 > capacity_ * 7) {
+            Rehash(GetCapacityFor(size_ + 1));
+        }
+        if (entries_.size() == entries_.capacity()) {
+            const size_t capacity = max<size_t>(4, entries_.capacity() * 2);
+            ChargeStorage(GetHeapBytes() + (capacity - entries_.capacity()) * sizeof(Entry));
+            entries_.reserve(capacity);
+        }
+        entries_.push_back(Entry{ std::move(key), std::move(value), hash });
+        InsertIndex(hash, static_cast<uint32_t>(entries_.size() - 1));
+        ++size_;
+        ++version_;
+    }
+
+    bool Dict::Erase(const ObjectHolder& key, Context& context) {
+        const size_t slot = FindSlot(key, Hash(key, context), context);
+        if (slot == NOT_FOUND) {
+            return false;
+        }
+        Entry& entry = entries_[slots_[slot]];
+        //    ,    
+        const ObjectHolder erased_key = std::move(entry.key);
+        const ObjectHolder erased_value = std::move(entry.value);
+        entry.erased = true;
+        control_[slot] = DELETED;
+        --size_;
+        ++version_;
+        return true;
+    }
+
+    void Dict::Clear() {
+        vector<Entry> entries;
+        entries.swap(entries_);
+        if (capacity_ != 0) {
+            fill_n(control_.get(), capacity_, EMPTY);
+        }
+        size_ = 0;
+        ++version_;
+    }
+
+    void Dict::Print(std::ostream& os, Context& context) {
+        // ,      : ,   ,   {...}
+        thread_local vector<const Dict*> printing;
+        if (find(printing.begin(), printing.end(), this) != printing.end()) {
+            os << "{...}"sv;
+            return;
+        }
+        printing.push_back(this);
+        try {
+            os << '{';
+            bool first = true;
+            for (const auto& entry : entries_) {
+                if (entry.erased) {
+                    continue;
+                }
+                os << (first ? ""sv : ", "sv);
+                first = false;
+                PrintItem(os, entry.key, context);
+                os << ": "sv;
+                PrintItem(os, entry.value, context);
+            }
+            os << '}';
+        } catch (...) {
+            printing.pop_back();
+            throw;
+        }
+        printing.pop_back();
+    }
+
+    ObjectHolder Dict::Call(const std::string& method, Arguments args, Context& context) {
+        context.ChargeFuel();
+        if (method == "get"sv && (args.size == 1 || args.size == 2)) {
+            if (const ObjectHolder* value = Find(args.data[0], context)) {
+                return *value;
+            }
+            return args.size == 2 ? std::move(args.data[1]) : ObjectHolder::None();
+        }
+        if (method == "pop"sv && args.size == 1) {
+            ObjectHolder value = Get(args.data[0], context);
+            Erase(args.data[0], context);
+            return value;
+        }
+        if ((method == "keys"sv || method == "values"sv) && args.size == 0) {
+            const bool keys = method == "keys"sv;
+            ObjectHolder holder = ObjectHolder::Own(List());
+            if (auto* collector = context.GetCycleCollector()) {
+                collector->Track(holder);
+            }
+            auto* list = holder.TryAs<List>();
+            for (const auto& entry : entries_) {
+                if (!entry.erased) {
+                    list->Append(keys ? entry.key : entry.value);
+                }
+            }
+            return holder;
+        }
+        throw runtime_error("");
+    }
+
+    bool Contains(const ObjectHolder& container, const ObjectHolder& item, Context& context) {
+        if (auto* dict = container.TryAs<Dict>()) {
+            return dict->Find(item, context) != nullptr;
+        }
+        if (const auto* list = container.TryAs<List>()) {
+            if (list->HoldsIntegers()) {
+                const auto* num = item.TryAs<Number>();
+                const auto& integers = list->GetIntegers();
+                if (num != nullptr) {
+                    return find(integers.begin(), integers.end(), num->GetValue()) != integers.end();
+                }
+                //          ,  1.0
+                if (!IsNumeric(item)) {
+                    return false;
+                }
+                for (const int64_t value : integers) {
+                    if (Dict::KeysEqual(ObjectHolder::Own(Number(value)), item, context)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            for (const auto& element : list->GetObjects()) {
+                if (Dict::KeysEqual(element, item, context)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        if (const auto* str = container.TryAs<String>()) {
+            const auto* part = item.TryAs<String>();
+            if (part == nullptr) {
+                throw runtime_error("");
+            }
+            return str->GetValue().find(part->GetValue()) != string::npos;
+        }
+        throw runtime_error("");
+    }
+
+}  // namespace runtime
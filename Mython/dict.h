@@ -0,0 +1,147 @@
+#pragma once
+
+#include "runtime.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace runtime {
+
+    // .        ,    
+    // ,         SwissTable.  
+    //     GROUP_SIZE;      : ,
+    //   ,          .  
+    //       ( x86 -   SSE2)    
+    //   ,            .
+    //
+    //         ,     
+    // (1  1.0)   .     __hash__   
+    // ,     __eq__   ;     
+    //  .       
+    class Dict : public Object {
+    public:
+        struct Entry {
+            ObjectHolder key;
+            ObjectHolder value;
+            std::uint64_t hash = 0;
+            //         
+            bool erased = false;
+        };
+
+        Dict() = default;
+        //               
+        Dict(const Dict& other);
+        Dict(Dict&&) = default;
+        Dict& operator=(const Dict&) = delete;
+
+        //     : {'a': 1, 2: None}
+        void Print(std::ostream& os, Context& context) override;
+
+        [[nodiscard]] size_t GetSize() const {
+            return size_;
+        }
+
+        //     nullptr,   .     runtime_error
+        [[nodiscard]] ObjectHolder* Find(const ObjectHolder& key, Context& context);
+        //   .   ,  runtime_error
+        [[nodiscard]] ObjectHolder Get(const ObjectHolder& key, Context& context);
+        void Set(ObjectHolder key, ObjectHolder value, Context& context);
+        //  .  false,    
+        bool Erase(const ObjectHolder& key, Context& context);
+        //   .  ,    
+        void Clear();
+
+        //       ,     
+        [[nodiscard]] std::uint64_t GetVersion() const {
+            return version_;
+        }
+
+        //    ,   (erased)
+        [[nodiscard]] const std::vector<Entry>& GetEntries() const {
+            return entries_;
+        }
+
+        //      transform,    .    
+        //  ; ,    ,   
+        template <typename Transform>
+        void TransformEntries(Transform transform) {
+            bool rehash = false;
+            for (auto& entry : entries_) {
+                if (entry.erased) {
+                    continue;
+                }
+                const bool identity = IsHashedByIdentity(entry.key);
+                entry.key = transform(entry.key);
+                entry.value = transform(entry.value);
+                if (identity) {
+                    entry.hash = IdentityHash(entry.key);
+                    rehash = true;
+                }
+            }
+            if (rehash) {
+                Rehash(capacity_);
+            }
+        }
+
+        //   : get(key), get(key, default), pop(key), keys()  values().
+        //     runtime_error
+        ObjectHolder Call(const std::string& method, Arguments args, Context& context);
+
+        //    
+        [[nodiscard]] size_t GetHeapBytes() const {
+            return entries_.capacity() * sizeof(Entry) + capacity_ * (sizeof(std::uint32_t) + 1);
+        }
+
+        //  .  ,       runtime_error
+        [[nodiscard]] static std::uint64_t Hash(const ObjectHolder& key, Context& context);
+        //  .    Equal,      
+        [[nodiscard]] static bool KeysEqual(const ObjectHolder& lhs, const ObjectHolder& rhs, Context& context);
+
+        static constexpr size_t GROUP_SIZE = 16;
+
+    private:
+        static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+        static bool IsHashedByIdentity(const ObjectHolder& key);
+        static std::uint64_t IdentityHash(const ObjectHolder& key);
+
+        //  ,      key,  NOT_FOUND
+        size_t FindSlot(const ObjectHolder& key, std::uint64_t hash, Context& context) const;
+        //    entry  ;     
+        void InsertIndex(std::uint64_t hash, std::uint32_t entry);
+        //    capacity ,   
+        void Rehash(size_t capacity);
+        //        bytes
+        void ChargeStorage(size_t bytes);
+
+        std::vector<Entry> entries_;
+        //       
+        std::unique_ptr<std::int8_t[]> control_;
+        std::unique_ptr<std::uint32_t[]> slots_;
+        //   ,  GROUP_SIZE  .  ,    ,
+        //    ,     7/8 
+        size_t capacity_ = 0;
+        size_t size_ = 0;
+        //       .  __eq__    ,
+        //     
+        std::uint64_t version_ = 0;
+        MemoryCharge storage_charge_{ MemoryKind::Dict };
+        size_t charged_bytes_ = 0;
+    };
+
+    template <>
+    struct MemoryTraits<Dict> {
+        static constexpr MemoryKind KIND = MemoryKind::Dict;
+
+        static size_t GetExtraBytes(const Dict&) {
+            return 0;
+        }
+    };
+
+    //  true,  container - ,  item,    item
+    //     item.     runtime_error
+    bool Contains(const ObjectHolder& container, const ObjectHolder& item, Context& context);
+
+}  // namespace runtime
@@ -0,0 +1,178 @@
+#include "executor.h"
+
+#include "cycle_collector.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+using namespace std;
+
+namespace executor {
+
+    namespace {
+        class WorkStealingQueues {
+        public:
+            explicit WorkStealingQueues(size_t count)
+                : queues_(count) {
+            }
+
+            void Push(size_t worker, size_t job) {
+                lock_guard guard(queues_[worker].queue_mutex);
+                queues_[worker].jobs.push_back(job);
+            }
+
+            //     ,     -   
+            optional<size_t> Pop(size_t worker, bool& stolen) {
+                {
+                    Queue& own = queues_[worker];
+                    lock_guard guard(own.queue_mutex);
+                    if (!own.jobs.empty()) {
+                        size_t job = own.jobs.back();
+                        own.jobs.pop_back();
+                        stolen = false;
+                        return job;
+                    }
+                }
+                for (size_t i = 1; i < queues_.size(); ++i) {
+                    Queue& victim = queues_[(worker + i) % queues_.size()];
+                    lock_guard guard(victim.queue_mutex);
+                    if (!victim.jobs.empty()) {
+                        size_t job = victim.jobs.front();
+                        victim.jobs.pop_front();
+                        stolen = true;
+                        return job;
+                    }
+                }
+                //        ,   
+                return nullopt;
+            }
+
+        private:
+            struct Queue {
+                mutex queue_mutex;
+                deque<size_t> jobs;
+            };
+
+            vector<Queue> queues_;
+        };
+
+        void ExecuteJob(Job& job, JobResult& result) {
+            const shared_ptr<runtime::MemoryAccount> memory = job.CreateMemoryAccount();
+            const runtime::MemoryAccount::Scope memory_scope(memory);
+            runtime::CycleCollector collector;
+            runtime::Closure closure = job.input;
+            const runtime::ClosureCharge closure_charge(closure);
+            runtime::ExecutionBudget budget(job.fuel_limit);
+            try {
+                if (!job.program || job.output == nullptr) {
+                    throw invalid_argument("Job has no program or output"s);
+                }
+                runtime::SimpleContext context{ *job.output };
+                context.SetBudget(&budget);
+                context.SetCycleCollector(&collector);
+                job.program->Execute(closure, context);
+                result.ok = true;
+            }
+            catch (const exception& e) {
+                result.error = e.what();
+            }
+            catch (...) {
+                result.error = "Unknown error"s;
+            }
+            result.fuel_used = budget.GetUsed();
+            if (memory) {
+                result.memory = memory->GetStats();
+            }
+        }
+    }  // namespace
+
+    shared_ptr<runtime::MemoryAccount> Job::CreateMemoryAccount() const {
+        if (!memory_stats && memory_limit == runtime::MemoryAccount::UNLIMITED) {
+            return nullptr;
+        }
+        return make_shared<runtime::MemoryAccount>(memory_limit);
+    }
+
+    double BatchReport::Throughput() const {
+        const chrono::duration<double> seconds = wall_time;
+        return seconds.count() > 0 ? static_cast<double>(jobs.size()) / seconds.count() : 0.0;
+    }
+
+    Clock::duration BatchReport::LatencyPercentile(double percentile) const {
+        if (jobs.empty()) {
+            return {};
+        }
+        vector<Clock::duration> latencies;
+        latencies.reserve(jobs.size());
+        for (const auto& job : jobs) {
+            latencies.push_back(job.Latency());
+        }
+        const double clamped = clamp(percentile, 0.0, 1.0);
+        const size_t index = min(latencies.size() - 1, static_cast<size_t>(clamped * latencies.size()));
+        nth_element(latencies.begin(), latencies.begin() + index, latencies.end());
+        return latencies[index];
+    }
+
+    size_t BatchReport::FailedCount() const {
+        return count_if(jobs.begin(), jobs.end(), [](const JobResult& job) {
+            return !job.ok;
+        });
+    }
+
+    BatchExecutor::BatchExecutor(size_t thread_count)
+        : thread_count_(thread_count != 0 ? thread_count : max(thread::hardware_concurrency(), 1u)) {
+    }
+
+    size_t BatchExecutor::ThreadCount() const {
+        return thread_count_;
+    }
+
+    BatchReport BatchExecutor::Run(vector<Job>& jobs) const {
+        BatchReport report;
+        report.jobs.resize(jobs.size());
+
+        const size_t worker_count = max<size_t>(min(thread_count_, jobs.size()), 1);
+        WorkStealingQueues queues(worker_count);
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            queues.Push(i % worker_count, i);
+        }
+
+        atomic<size_t> steals{ 0 };
+        const auto batch_start = Clock::now();
+
+        auto worker = [&](size_t worker_id) {
+            bool stolen = false;
+            while (auto job = queues.Pop(worker_id, stolen)) {
+                if (stolen) {
+                    ++steals;
+                }
+                JobResult& result = report.jobs[*job];
+                const auto start = Clock::now();
+                ExecuteJob(jobs[*job], result);
+                result.queue_time = start - batch_start;
+                result.run_time = Clock::now() - start;
+                result.worker = worker_id;
+            }
+        };
+
+        vector<thread> threads;
+        threads.reserve(worker_count - 1);
+        for (size_t i = 1; i < worker_count; ++i) {
+            threads.emplace_back(worker, i);
+        }
+        worker(0);
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        report.wall_time = Clock::now() - batch_start;
+        report.steals = steals;
+        return report;
+    }
+
+}  // namespace executor
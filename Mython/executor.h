@@ -0,0 +1,92 @@
+#pragma once
+
+#include "runtime.h"
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace executor {
+
+    using Clock = std::chrono::steady_clock;
+
+    // :  ,      
+    struct Job {
+        //     ,       
+        std::shared_ptr<runtime::Executable> program;
+        //  ,    .     
+        // ,    
+        runtime::Closure input;
+        //   print. ,  ,     
+        std::ostream* output = nullptr;
+        //      (. runtime::ExecutionBudget).
+        // ,  ,  ,   
+        uint64_t fuel_limit = runtime::ExecutionBudget::UNLIMITED;
+        //          (. runtime::MemoryAccount).
+        // ,  ,  
+        size_t memory_limit = runtime::MemoryAccount::UNLIMITED;
+        //  JobResult::memory.        :
+        //   
+        bool memory_stats = false;
+
+        //       nullptr,     
+        [[nodiscard]] std::shared_ptr<runtime::MemoryAccount> CreateMemoryAccount() const;
+    };
+
+    //    
+    struct JobResult {
+        bool ok = false;
+        //  ,    
+        std::string error;
+        //        
+        Clock::duration queue_time{};
+        //   
+        Clock::duration run_time{};
+        //  ,  
+        size_t worker = 0;
+        //  
+        uint64_t fuel_used = 0;
+        // ,  ,      .
+        // ,     memory_limit  memory_stats
+        runtime::MemoryStats memory;
+
+        //       
+        [[nodiscard]] Clock::duration Latency() const {
+            return queue_time + run_time;
+        }
+    };
+
+    struct BatchReport {
+        //    
+        std::vector<JobResult> jobs;
+        Clock::duration wall_time{};
+        //  ,     
+        size_t steals = 0;
+
+        //     
+        [[nodiscard]] double Throughput() const;
+        // ,     percentile  ( 0  1)
+        [[nodiscard]] Clock::duration LatencyPercentile(double percentile) const;
+        [[nodiscard]] size_t FailedCount() const;
+    };
+
+    //   Mython-      .
+    //       .       ,
+    //        .     
+    // Closure  Context,       
+    class BatchExecutor {
+    public:
+        // thread_count == 0 -   
+        explicit BatchExecutor(size_t thread_count = 0);
+
+        [[nodiscard]] size_t ThreadCount() const;
+
+        BatchReport Run(std::vector<Job>& jobs) const;
+
+    private:
+        size_t thread_count_;
+    };
+
+}  // namespace executor
@@ -0,0 +1,81 @@
+#include "frame_stack.h"
+
+#include <new>
+#include <utility>
+
+namespace runtime {
+
+    FrameStack& FrameStack::ForThread() {
+        thread_local FrameStack stack;
+        return stack;
+    }
+
+    FrameStack::ArgumentFrame::ArgumentFrame(FrameStack& stack)
+        : stack_(stack)
+        , base_(stack.arguments_.size()) {
+    }
+
+    FrameStack::ArgumentFrame::~ArgumentFrame() {
+        auto& values = stack_.arguments_;
+        values.erase(values.begin() + base_, values.end());
+    }
+
+    void FrameStack::ArgumentFrame::Push(ObjectHolder value) {
+        auto& values = stack_.arguments_;
+        if (values.size() == values.capacity()) {
+            ++stack_.allocations_;
+        }
+        values.push_back(std::move(value));
+    }
+
+    Arguments FrameStack::ArgumentFrame::Get() {
+        auto& values = stack_.arguments_;
+        return { values.data() + base_, values.size() - base_ };
+    }
+
+    FrameStack::LocalFrame::LocalFrame(FrameStack& stack)
+        : stack_(stack)
+        , closure_(stack.NextFrame()) {
+        ++stack_.depth_;
+    }
+
+    FrameStack::LocalFrame::~LocalFrame() {
+        auto& free_entries = stack_.free_entries_;
+        while (!closure_.empty()) {
+            Closure::node_type entry = closure_.extract(closure_.begin());
+            entry.mapped() = ObjectHolder();
+            if (free_entries.size() < MAX_FREE_ENTRIES) {
+                if (free_entries.size() == free_entries.capacity()) {
+                    ++stack_.allocations_;
+                }
+                try {
+                    free_entries.push_back(std::move(entry));
+                }
+                catch (const std::bad_alloc&) {
+                    //   
+                }
+            }
+        }
+        --stack_.depth_;
+    }
+
+    Closure& FrameStack::NextFrame() {
+        if (depth_ < frames_.size()) {
+            return frames_[depth_];
+        }
+        ++allocations_;
+        return frames_.emplace_back();
+    }
+
+    Closure::iterator FrameStack::Insert(Closure& closure, const std::string& name) {
+        if (free_entries_.empty()) {
+            ++allocations_;
+            return closure.try_emplace(name).first;
+        }
+        Closure::node_type entry = std::move(free_entries_.back());
+        free_entries_.pop_back();
+        entry.key() = name;
+        return closure.insert(std::move(entry)).position;
+    }
+
+}  // namespace runtime
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "runtime.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace runtime {
+
+    //    . ,       
+    //   ,        
+    class FrameStack {
+    public:
+        //         
+        static constexpr size_t MAX_FREE_ENTRIES = 4096;
+
+        [[nodiscard]] static FrameStack& ForThread();
+
+        //      :   ,   
+        //   ,    
+        [[nodiscard]] size_t GetAllocations() const {
+            return allocations_;
+        }
+
+        //       .  , 
+        //   ,         
+        class ArgumentFrame {
+        public:
+            explicit ArgumentFrame(FrameStack& stack);
+            ~ArgumentFrame();
+
+            ArgumentFrame(const ArgumentFrame&) = delete;
+            ArgumentFrame& operator=(const ArgumentFrame&) = delete;
+
+            void Push(ObjectHolder value);
+
+            //       Push
+            [[nodiscard]] Arguments Get();
+
+        private:
+            FrameStack& stack_;
+            size_t base_;
+        };
+
+        //    .     ,
+        //         
+        class LocalFrame {
+        public:
+            explicit LocalFrame(FrameStack& stack);
+            ~LocalFrame();
+
+            LocalFrame(const LocalFrame&) = delete;
+            LocalFrame& operator=(const LocalFrame&) = delete;
+
+            [[nodiscard]] Closure& GetClosure() {
+                return closure_;
+            }
+
+        private:
+            FrameStack& stack_;
+            Closure& closure_;
+        };
+
+        //   closure  name,    ,  
+        //   
+        Closure::iterator Insert(Closure& closure, const std::string& name);
+
+    private:
+        //      depth_,       
+        Closure& NextFrame();
+
+        std::vector<ObjectHolder> arguments_;
+        // deque    ,  ,   
+        std::deque<Closure> frames_;
+        size_t depth_ = 0;
+        std::vector<Closure::node_type> free_entries_;
+        size_t allocations_ = 0;
+    };
+
+}  // namespace runtime
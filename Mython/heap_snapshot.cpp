@@ -0,0 +1,463 @@
+#include "heap_snapshot.h"
+
+#include "dict.h"
+
+#include <algorithm>
+#include <deque>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <unordered_map>
+
+using namespace std;
+
+namespace runtime {
+
+    namespace {
+
+        constexpr string_view MAGIC = "MYHS"sv;
+        constexpr uint8_t VERSION = 1;
+        constexpr uint32_t UNDEFINED = static_cast<uint32_t>(-1);
+
+        HeapNode DescribeObject(const Object& object) {
+            HeapNode node;
+            if (const auto* instance = dynamic_cast<const ClassInstance*>(&object)) {
+                node.type = "Instance"s;
+                node.class_name = instance->GetClass().GetName();
+                node.shallow_size = sizeof(ClassInstance) + instance->Fields().GetHeapBytes();
+            }
+            else if (const auto* str = dynamic_cast<const String*>(&object)) {
+                node.type = "String"s;
+                node.shallow_size = sizeof(String) + GetStringHeapBytes(str->GetValue());
+            }
+            else if (dynamic_cast<const Number*>(&object) != nullptr) {
+                node.type = "Number"s;
+                node.shallow_size = sizeof(Number);
+            }
+            else if (dynamic_cast<const Float*>(&object) != nullptr) {
+                node.type = "Float"s;
+                node.shallow_size = sizeof(Float);
+            }
+            else if (const auto* num = dynamic_cast<const BigNumber*>(&object)) {
+                node.type = "Number"s;
+                node.shallow_size = sizeof(BigNumber) + num->GetValue().GetHeapBytes();
+            }
+            else if (dynamic_cast<const Bool*>(&object) != nullptr) {
+                node.type = "Bool"s;
+                node.shallow_size = sizeof(Bool);
+            }
+            else if (const auto* list = dynamic_cast<const List*>(&object)) {
+                node.type = "List"s;
+                node.shallow_size = sizeof(List) + list->GetHeapBytes();
+            }
+            else if (const auto* dict = dynamic_cast<const Dict*>(&object)) {
+                node.type = "Dict"s;
+                node.shallow_size = sizeof(Dict) + dict->GetHeapBytes();
+            }
+            else if (const auto* cls = dynamic_cast<const Class*>(&object)) {
+                node.type = "Class"s;
+                node.class_name = cls->GetName();
+                node.shallow_size = sizeof(Class) + GetStringHeapBytes(cls->GetName());
+            }
+            else {
+                node.type = "Object"s;
+                node.shallow_size = sizeof(Object);
+            }
+            return node;
+        }
+
+        //          ,  
+        //     -
+        template <typename Table>
+        vector<const typename Table::value_type*> SortedEntries(const Table& table) {
+            vector<const typename Table::value_type*> entries;
+            entries.reserve(table.size());
+            for (const auto& entry : table) {
+                if (entry.second) {
+                    entries.push_back(&entry);
+                }
+            }
+            sort(entries.begin(), entries.end(), [](const auto* lhs, const auto* rhs) {
+                return lhs->first < rhs->first;
+            });
+            return entries;
+        }
+
+        void WriteVarint(ostream& out, uint64_t value) {
+            while (value >= 0x80) {
+                out.put(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            out.put(static_cast<char>(value));
+        }
+
+        uint64_t ReadVarint(istream& in) {
+            uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                const int byte = in.get();
+                if (byte == char_traits<char>::eof()) {
+                    throw runtime_error("Truncated heap snapshot"s);
+                }
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return value;
+                }
+            }
+            throw runtime_error("Invalid number in heap snapshot"s);
+        }
+
+        //     .      
+        uint64_t GetRemainingBytes(istream& in) {
+            const auto position = in.tellg();
+            if (position == istream::pos_type(-1)) {
+                return numeric_limits<uint64_t>::max();
+            }
+            in.seekg(0, ios_base::end);
+            const auto end = in.tellg();
+            in.seekg(position);
+            if (end == istream::pos_type(-1) || !in) {
+                throw runtime_error("Truncated heap snapshot"s);
+            }
+            return static_cast<uint64_t>(end - position);
+        }
+
+        //  ,         min_bytes .
+        //         
+        uint64_t ReadCount(istream& in, uint64_t min_bytes) {
+            const uint64_t count = ReadVarint(in);
+            if (count > GetRemainingBytes(in) / min_bytes) {
+                throw runtime_error("Truncated heap snapshot"s);
+            }
+            return count;
+        }
+
+        class StringTable {
+        public:
+            uint64_t Add(const string& str) {
+                auto [it, inserted] = indices_.emplace(str, strings_.size());
+                if (inserted) {
+                    strings_.push_back(&it->first);
+                }
+                return it->second;
+            }
+
+            void Write(ostream& out) const {
+                WriteVarint(out, strings_.size());
+                for (const string* str : strings_) {
+                    WriteVarint(out, str->size());
+                    out.write(str->data(), static_cast<streamsize>(str->size()));
+                }
+            }
+
+        private:
+            unordered_map<string, uint64_t> indices_;
+            vector<const string*> strings_;
+        };
+
+        //    :    -    
+        vector<pair<uint32_t, const string*>> FindShortestPaths(const vector<HeapNode>& nodes) {
+            vector<pair<uint32_t, const string*>> parents(nodes.size(), { UNDEFINED, nullptr });
+            deque<uint32_t> queue{ HeapSnapshot::ROOT };
+            parents[HeapSnapshot::ROOT].first = HeapSnapshot::ROOT;
+            while (!queue.empty()) {
+                const uint32_t node = queue.front();
+                queue.pop_front();
+                for (const HeapEdge& edge : nodes[node].edges) {
+                    if (parents[edge.target].first == UNDEFINED) {
+                        parents[edge.target] = { node, &edge.name };
+                        queue.push_back(edge.target);
+                    }
+                }
+            }
+            return parents;
+        }
+
+        string DescribeNode(const HeapNode& node) {
+            return node.class_name.empty() ? node.type : node.type + " "s + node.class_name;
+        }
+
+    }  // namespace
+
+    HeapSnapshot HeapSnapshot::Take(const Closure& globals) {
+        HeapSnapshot snapshot;
+        snapshot.nodes_.push_back(HeapNode{ "(globals)"s, {}, 0, 0, {} });
+
+        unordered_map<const Object*, uint32_t> ids;
+        vector<const Object*> objects{ nullptr };
+        const auto get_id = [&](const ObjectHolder& holder) {
+            auto [it, inserted] = ids.emplace(holder.Get(), static_cast<uint32_t>(objects.size()));
+            if (inserted) {
+                objects.push_back(holder.Get());
+                snapshot.nodes_.push_back(DescribeObject(*holder));
+            }
+            return it->second;
+        };
+
+        for (const auto* entry : SortedEntries(globals)) {
+            const uint32_t target = get_id(entry->second);
+            snapshot.nodes_[ROOT].edges.push_back({ entry->first, target });
+        }
+        //     ,   -      
+        for (size_t id = 1; id < objects.size(); ++id) {
+            if (const auto* instance = dynamic_cast<const ClassInstance*>(objects[id])) {
+                for (const auto* entry : SortedEntries(instance->Fields())) {
+                    const uint32_t target = get_id(entry->second);
+                    snapshot.nodes_[id].edges.push_back({ entry->first, target });
+                }
+            }
+            //            
+            else if (const auto* list = dynamic_cast<const List*>(objects[id])) {
+                const auto& items = list->GetObjects();
+                for (size_t i = 0; i < items.size(); ++i) {
+                    if (items[i]) {
+                        const uint32_t target = get_id(items[i]);
+                        snapshot.nodes_[id].edges.push_back({ "["s + to_string(i) + "]"s, target });
+                    }
+                }
+            }
+            //      ,  
+            else if (const auto* dict = dynamic_cast<const Dict*>(objects[id])) {
+                size_t index = 0;
+                for (const auto& entry : dict->GetEntries()) {
+                    if (entry.erased) {
+                        continue;
+                    }
+                    const string suffix = "["s + to_string(index++) + "]"s;
+                    if (entry.key) {
+                        const uint32_t target = get_id(entry.key);
+                        snapshot.nodes_[id].edges.push_back({ "key"s + suffix, target });
+                    }
+                    if (entry.value) {
+                        const uint32_t target = get_id(entry.value);
+                        snapshot.nodes_[id].edges.push_back({ "value"s + suffix, target });
+                    }
+                }
+            }
+        }
+
+        snapshot.ComputeRetainedSizes();
+        return snapshot;
+    }
+
+    void HeapSnapshot::ComputeRetainedSizes() {
+        //    Cooper, Harvey, Kennedy      
+        const size_t count = nodes_.size();
+        vector<uint32_t> postorder;
+        postorder.reserve(count);
+        vector<uint32_t> order(count, UNDEFINED);
+        vector<bool> visited(count, false);
+        vector<pair<uint32_t, size_t>> stack{ { ROOT, 0 } };
+        visited[ROOT] = true;
+        while (!stack.empty()) {
+            auto& [node, next_edge] = stack.back();
+            if (next_edge < nodes_[node].edges.size()) {
+                const uint32_t target = nodes_[node].edges[next_edge++].target;
+                if (!visited[target]) {
+                    visited[target] = true;
+                    stack.push_back({ target, 0 });
+                }
+            }
+            else {
+                order[node] = static_cast<uint32_t>(postorder.size());
+                postorder.push_back(node);
+                stack.pop_back();
+            }
+        }
+
+        vector<vector<uint32_t>> predecessors(count);
+        for (uint32_t node = 0; node < count; ++node) {
+            for (const HeapEdge& edge : nodes_[node].edges) {
+                predecessors[edge.target].push_back(node);
+            }
+        }
+
+        vector<uint32_t> dominator(count, UNDEFINED);
+        dominator[ROOT] = ROOT;
+        const auto intersect = [&](uint32_t lhs, uint32_t rhs) {
+            while (lhs != rhs) {
+                while (order[lhs] < order[rhs]) {
+                    lhs = dominator[lhs];
+                }
+                while (order[rhs] < order[lhs]) {
+                    rhs = dominator[rhs];
+                }
+            }
+            return lhs;
+        };
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (auto it = postorder.rbegin(); it != postorder.rend(); ++it) {
+                const uint32_t node = *it;
+                if (node == ROOT) {
+                    continue;
+                }
+                uint32_t new_dominator = UNDEFINED;
+                for (const uint32_t predecessor : predecessors[node]) {
+                    if (dominator[predecessor] != UNDEFINED) {
+                        new_dominator = new_dominator == UNDEFINED ? predecessor : intersect(predecessor, new_dominator);
+                    }
+                }
+                if (dominator[node] != new_dominator) {
+                    dominator[node] = new_dominator;
+                    changed = true;
+                }
+            }
+        }
+
+        for (HeapNode& node : nodes_) {
+            node.retained_size = node.shallow_size;
+        }
+        //       
+        for (const uint32_t node : postorder) {
+            if (node != ROOT) {
+                nodes_[dominator[node]].retained_size += nodes_[node].retained_size;
+            }
+        }
+    }
+
+    void HeapSnapshot::Write(ostream& out) const {
+        StringTable strings;
+        for (const HeapNode& node : nodes_) {
+            strings.Add(node.type);
+            strings.Add(node.class_name);
+            for (const HeapEdge& edge : node.edges) {
+                strings.Add(edge.name);
+            }
+        }
+
+        out.write(MAGIC.data(), static_cast<streamsize>(MAGIC.size()));
+        out.put(static_cast<char>(VERSION));
+        strings.Write(out);
+        WriteVarint(out, nodes_.size());
+        for (const HeapNode& node : nodes_) {
+            WriteVarint(out, strings.Add(node.type));
+            WriteVarint(out, strings.Add(node.class_name));
+            WriteVarint(out, node.shallow_size);
+            WriteVarint(out, node.retained_size);
+            WriteVarint(out, node.edges.size());
+            for (const HeapEdge& edge : node.edges) {
+                WriteVarint(out, strings.Add(edge.name));
+                WriteVarint(out, edge.target);
+            }
+        }
+    }
+
+    HeapSnapshot HeapSnapshot::Read(istream& in) {
+        string magic(MAGIC.size(), '\0');
+        in.read(magic.data(), static_cast<streamsize>(magic.size()));
+        if (!in || magic != MAGIC || in.get() != VERSION) {
+            throw runtime_error("Not a heap snapshot"s);
+        }
+
+        //  -   ,  -  ,  -  ,     
+        vector<string> strings(ReadCount(in, 1));
+        for (string& str : strings) {
+            str.resize(ReadCount(in, 1));
+            in.read(str.data(), static_cast<streamsize>(str.size()));
+            if (!in || in.gcount() != static_cast<streamsize>(str.size())) {
+                throw runtime_error("Truncated heap snapshot"s);
+            }
+        }
+        const auto read_string = [&]() -> const string& {
+            const uint64_t index = ReadVarint(in);
+            if (index >= strings.size()) {
+                throw runtime_error("Invalid string in heap snapshot"s);
+            }
+            return strings[index];
+        };
+
+        HeapSnapshot snapshot;
+        snapshot.nodes_.resize(ReadCount(in, 5));
+        for (HeapNode& node : snapshot.nodes_) {
+            node.type = read_string();
+            node.class_name = read_string();
+            node.shallow_size = ReadVarint(in);
+            node.retained_size = ReadVarint(in);
+            node.edges.resize(ReadCount(in, 2));
+            for (HeapEdge& edge : node.edges) {
+                edge.name = read_string();
+                const uint64_t target = ReadVarint(in);
+                if (target >= snapshot.nodes_.size()) {
+                    throw runtime_error("Invalid edge in heap snapshot"s);
+                }
+                edge.target = static_cast<uint32_t>(target);
+            }
+        }
+        if (snapshot.nodes_.empty()) {
+            throw runtime_error("Heap snapshot has no root"s);
+        }
+        return snapshot;
+    }
+
+    const vector<HeapNode>& HeapSnapshot::GetNodes() const {
+        return nodes_;
+    }
+
+    uint64_t HeapSnapshot::GetTotalSize() const {
+        return nodes_.empty() ? 0 : nodes_[ROOT].retained_size;
+    }
+
+    vector<HeapRetainer> FindTopRetainers(const HeapSnapshot& snapshot, size_t count) {
+        const auto& nodes = snapshot.GetNodes();
+        vector<uint32_t> ids;
+        for (uint32_t id = 1; id < nodes.size(); ++id) {
+            ids.push_back(id);
+        }
+        count = min(count, ids.size());
+        partial_sort(ids.begin(), ids.begin() + static_cast<ptrdiff_t>(count), ids.end(), [&](uint32_t lhs, uint32_t rhs) {
+            return nodes[lhs].retained_size != nodes[rhs].retained_size
+                ? nodes[lhs].retained_size > nodes[rhs].retained_size
+                : lhs < rhs;
+        });
+        ids.resize(count);
+
+        const auto parents = FindShortestPaths(nodes);
+        vector<HeapRetainer> retainers;
+        for (const uint32_t id : ids) {
+            vector<const string*> names;
+            for (uint32_t node = id; node != HeapSnapshot::ROOT && parents[node].second != nullptr; node = parents[node].first) {
+                names.push_back(parents[node].second);
+            }
+            string path;
+            for (auto it = names.rbegin(); it != names.rend(); ++it) {
+                if (!path.empty()) {
+                    path += '.';
+                }
+                path += **it;
+            }
+            retainers.push_back({ id, move(path) });
+        }
+        return retainers;
+    }
+
+    void PrintHeapReport(ostream& out, const HeapSnapshot& snapshot, size_t top_count) {
+        const auto& nodes = snapshot.GetNodes();
+        out << nodes.size() - 1 << " objects, "sv << snapshot.GetTotalSize() << " bytes reachable from globals\n"sv;
+
+        map<string, pair<size_t, uint64_t>> by_kind;
+        for (uint32_t id = 1; id < nodes.size(); ++id) {
+            auto& [objects, bytes] = by_kind[DescribeNode(nodes[id])];
+            ++objects;
+            bytes += nodes[id].shallow_size;
+        }
+        vector<pair<string, pair<size_t, uint64_t>>> kinds(by_kind.begin(), by_kind.end());
+        stable_sort(kinds.begin(), kinds.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second.second > rhs.second.second;
+        });
+        out << "\nBy type:\n"sv << setw(12) << "objects"sv << setw(14) << "bytes"sv << "  type\n"sv;
+        for (const auto& [kind, totals] : kinds) {
+            out << setw(12) << totals.first << setw(14) << totals.second << "  "sv << kind << '\n';
+        }
+
+        out << "\nTop retainers:\n"sv << setw(14) << "retained"sv << setw(12) << "shallow"sv << "  object\n"sv;
+        for (const HeapRetainer& retainer : FindTopRetainers(snapshot, top_count)) {
+            const HeapNode& node = nodes[retainer.node];
+            out << setw(14) << node.retained_size << setw(12) << node.shallow_size << "  "sv
+                << retainer.path << " ("sv << DescribeNode(node) << ")\n"sv;
+        }
+    }
+
+}  // namespace runtime
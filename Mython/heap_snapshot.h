@@ -0,0 +1,68 @@
+#pragma once
+
+#include "runtime.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace runtime {
+
+    struct HeapEdge {
+        //    
+        std::string name;
+        uint32_t target = 0;
+    };
+
+    struct HeapNode {
+        // Number, Float, String, Bool, List, Dict, Instance, Class  Object;   - (globals)
+        std::string type;
+        //        
+        std::string class_name;
+        //            
+        uint64_t shallow_size = 0;
+        // ,  ,    :     ,
+        //          
+        uint64_t retained_size = 0;
+        std::vector<HeapEdge> edges;
+    };
+
+    //   ,     .
+    //  0 - ,   -  .  None    .
+    //       
+    class HeapSnapshot {
+    public:
+        static constexpr uint32_t ROOT = 0;
+
+        //  ,   globals.     
+        static HeapSnapshot Take(const Closure& globals);
+
+        //   :    ,     varint
+        void Write(std::ostream& out) const;
+        //  runtime_error,        
+        static HeapSnapshot Read(std::istream& in);
+
+        [[nodiscard]] const std::vector<HeapNode>& GetNodes() const;
+        //     
+        [[nodiscard]] uint64_t GetTotalSize() const;
+
+    private:
+        void ComputeRetainedSizes();
+
+        std::vector<HeapNode> nodes_;
+    };
+
+    struct HeapRetainer {
+        uint32_t node = 0;
+        //     ,  cache.items.next
+        std::string path;
+    };
+
+    //     ,  
+    [[nodiscard]] std::vector<HeapRetainer> FindTopRetainers(const HeapSnapshot& snapshot, size_t count);
+
+    //        top_count ,    
+    void PrintHeapReport(std::ostream& out, const HeapSnapshot& snapshot, size_t top_count = 20);
+
+}  // namespace runtime
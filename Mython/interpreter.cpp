@@ -0,0 +1,62 @@
+#include "interpreter.h"
+
+#include "cycle_collector.h"
+#include "lexer.h"
+#include "runtime.h"
+#include "statement.h"
+
+using namespace std;
+
+void RunMythonProgram(istream& input, ostream& output, MethodParsing method_parsing) {
+    runtime::SimpleContext context{ output };
+    RunMythonProgram(input, context, method_parsing);
+}
+
+void RunMythonProgram(istream& input, runtime::Context& context, MethodParsing method_parsing) {
+    RunMythonProgram(input, context, method_parsing, {});
+}
+
+namespace {
+
+    // Подключает сборщик циклов к контексту, если у того нет своего, и отключает его при выходе
+    class CollectorBinding {
+    public:
+        CollectorBinding(runtime::Context& context, runtime::CycleCollector& collector)
+            : context_(context)
+            , bound_(context.GetCycleCollector() == nullptr) {
+            if (bound_) {
+                context_.SetCycleCollector(&collector);
+            }
+        }
+
+        ~CollectorBinding() {
+            if (bound_) {
+                context_.SetCycleCollector(nullptr);
+            }
+        }
+
+        CollectorBinding(const CollectorBinding&) = delete;
+        CollectorBinding& operator=(const CollectorBinding&) = delete;
+
+    private:
+        runtime::Context& context_;
+        bool bound_;
+    };
+
+}  // namespace
+
+void RunMythonProgram(istream& input, runtime::Context& context, MethodParsing method_parsing,
+    const GlobalsInspector& inspect_globals) {
+    parse::Lexer lexer(input);
+    auto program = ParseProgram(lexer, method_parsing);
+
+    // Сборщик объявлен раньше глобальных переменных, чтобы собрать циклы, оставшиеся после них
+    runtime::CycleCollector collector;
+    const CollectorBinding collector_binding(context, collector);
+    runtime::Closure closure;
+    const runtime::ClosureCharge closure_charge(closure);
+    program->Execute(closure, context);
+    if (inspect_globals) {
+        inspect_globals(closure);
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "parse.h"
+
+#include <functional>
+#include <iosfwd>
+
+namespace runtime {
+    class Context;
+}
+
+//       ,     
+using GlobalsInspector = std::function<void(const runtime::Closure&)>;
+
+//  Mython-  input   ,    print  output
+void RunMythonProgram(std::istream& input, std::ostream& output,
+    MethodParsing method_parsing = MethodParsing::Eager);
+
+//  ,      ,   runtime::BufferedContext
+void RunMythonProgram(std::istream& input, runtime::Context& context,
+    MethodParsing method_parsing = MethodParsing::Eager);
+
+//  ,        inspect_globals
+void RunMythonProgram(std::istream& input, runtime::Context& context, MethodParsing method_parsing,
+    const GlobalsInspector& inspect_globals);
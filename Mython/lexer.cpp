@@ -1,6 +1,7 @@
 #include "lexer.h"
 
 #include <algorithm>
+#include <cctype>
 #include <charconv>
 #include <unordered_map>
 
@@ -20,6 +21,9 @@ namespace parse {
         if (lhs.Is<Number>()) {
             return lhs.As<Number>().value == rhs.As<Number>().value;
         }
+        if (lhs.Is<Float>()) {
+            return lhs.As<Float>().value == rhs.As<Float>().value;
+        }
         if (lhs.Is<String>()) {
             return lhs.As<String>().value == rhs.As<String>().value;
         }
@@ -40,6 +44,7 @@ namespace parse {
     if (auto p = rhs.TryAs<type>()) return os << #type << '{' << p->value << '}';
 
         VALUED_OUTPUT(Number);
+        VALUED_OUTPUT(Float);
         VALUED_OUTPUT(Id);
         VALUED_OUTPUT(String);
         VALUED_OUTPUT(Char);
@@ -61,6 +66,11 @@ namespace parse {
         UNVALUED_OUTPUT(And);
         UNVALUED_OUTPUT(Or);
         UNVALUED_OUTPUT(Not);
+        UNVALUED_OUTPUT(In);
+        UNVALUED_OUTPUT(While);
+        UNVALUED_OUTPUT(For);
+        UNVALUED_OUTPUT(Break);
+        UNVALUED_OUTPUT(Continue);
         UNVALUED_OUTPUT(Eq);
         UNVALUED_OUTPUT(NotEq);
         UNVALUED_OUTPUT(LessOrEq);
@@ -107,7 +117,8 @@ namespace parse {
         while (true) {
             input_.get(c);
             if (c == ' ' || c == '=' || c == '\n' ||  c == ':' || c == '*' || c == '-' || c == '/' 
-                || c == '+' || c == '!' || c == '#' || c == '(' || c == ')' || c==',' || c=='.') {
+                || c == '+' || c == '!' || c == '#' || c == '(' || c == ')' || c==',' || c=='.' || c == '[' || c == ']'
+                || c == '{' || c == '}') {
                 input_.putback(c);
                 break;
             }
@@ -143,6 +154,21 @@ namespace parse {
         else if (buf == "not") {
             token_ = token_type::Not{};
         }
+        else if (buf == "in") {
+            token_ = token_type::In{};
+        }
+        else if (buf == "while") {
+            token_ = token_type::While{};
+        }
+        else if (buf == "for") {
+            token_ = token_type::For{};
+        }
+        else if (buf == "break") {
+            token_ = token_type::Break{};
+        }
+        else if (buf == "continue") {
+            token_ = token_type::Continue{};
+        }
         else if (buf == "None") {
             token_ = token_type::None{};
         }
@@ -152,8 +178,11 @@ namespace parse {
         else if (buf == "False") {
             token_ = token_type::False{};
         }
-        else if (is_number(buf)) {
-            token_ = token_type::Number{ stoi(buf) };
+        else if (is_number(buf) && input_.peek() != '.') {
+            token_ = token_type::Number{ stoll(buf) };
+        }
+        else if (!buf.empty() && std::isdigit(static_cast<unsigned char>(buf[0]))) {
+            ParseFloat(std::move(buf));
         }
         else {
             if (!CheckIds(buf)) {
@@ -162,6 +191,36 @@ namespace parse {
             token_ = token_type::Id{ buf };
         }
     }
+    //    1.5, 2., 1.5e-3  1e9.  text      
+    //   ,  1  1e
+    void Lexer::ParseFloat(std::string text) {
+        const auto take_digits = [&]() {
+            while (std::isdigit(input_.peek())) {
+                text.push_back(static_cast<char>(input_.get()));
+            }
+        };
+        if (input_.peek() == '.') {
+            text.push_back(static_cast<char>(input_.get()));
+            take_digits();
+            if (input_.peek() == 'e' || input_.peek() == 'E') {
+                text.push_back(static_cast<char>(input_.get()));
+            }
+        }
+        if ((text.back() == 'e' || text.back() == 'E') && (input_.peek() == '+' || input_.peek() == '-')) {
+            text.push_back(static_cast<char>(input_.get()));
+        }
+        if (!std::isdigit(static_cast<unsigned char>(text.back())) && text.back() != '.') {
+            take_digits();
+        }
+
+        double value = 0.0;
+        const auto result = from_chars(text.data(), text.data() + text.size(), value);
+        if (result.ec != errc{} || result.ptr != text.data() + text.size()) {
+            throw LexerError("Bad number "s + text);
+        }
+        token_ = token_type::Float{ value };
+    }
+
     //void Lexer::ParseNumbers() {
     //    int buf;
     //    input_ >> buf;
@@ -278,6 +337,59 @@ namespace parse {
         FirstConstruct = false;
     }
 
+    Lexer::Lexer(std::vector<Token> tokens) : input_(empty_input_), tokens_(std::move(tokens)), replay_(true) {
+        if (tokens_.empty() || !tokens_.back().Is<token_type::Eof>()) {
+            tokens_.push_back(token_type::Eof{});
+        }
+        token_ = tokens_.front();
+        FirstConstruct = false;
+    }
+
+    bool Lexer::ReplaysTokens() const {
+        return replay_;
+    }
+
+    std::string Lexer::SkipIndentedBlock() {
+        if (replay_ || !token_.Is<token_type::Newline>()) {
+            throw LexerError("Indented block can't be skipped here"s);
+        }
+        const size_t level = Dedent;
+        std::string block;
+        std::string line;
+        while (input_) {
+            size_t spaces = 0;
+            while (input_.peek() == ' ') {
+                input_.get();
+                ++spaces;
+            }
+            const auto next = input_.peek();
+            const bool blank = next == '\n' || next == '#' || next == std::char_traits<char>::eof();
+            if (!blank && spaces <= level) {
+                for (size_t i = 0; i < spaces; ++i) {
+                    input_.putback(' ');
+                }
+                break;
+            }
+            std::getline(input_, line);
+            if (!blank) {
+                block.append(spaces - level, ' ');
+                block += line;
+                block.push_back('\n');
+            }
+        }
+        if (block.empty()) {
+            throw LexerError("Expected indented block"s);
+        }
+        if (!input_) {
+            input_.clear(std::ios::eofbit);
+        }
+        Indent = 0;
+        Dedent = level + 2;
+        TimeToCountInDedents = true;
+        CommentFlag = false;
+        return block;
+    }
+
     void Lexer::SetToken() {
         char c;
         input_.get(c);
@@ -306,7 +418,8 @@ namespace parse {
                 ParseString();
             }
             else if (c == '-' || c == '*' || c == '/' || c == '+' || c == '!' || c == '<'
-                || c == '>' || c == '=' || c == ':' || c == '(' || c == ')' || c == ',' || c == '.') {
+                || c == '>' || c == '=' || c == ':' || c == '(' || c == ')' || c == ',' || c == '.'
+                || c == '[' || c == ']' || c == '{' || c == '}') {
                 TimeToCountInDedents = false;
                 input_.putback(c);
                 ParseCharLogicOPerations();
@@ -367,6 +480,13 @@ namespace parse {
   */
     Token Lexer::NextToken() {
         // .   
+        if (replay_) {
+            if (token_pos_ + 1 < tokens_.size()) {
+                ++token_pos_;
+            }
+            token_ = tokens_[token_pos_];
+            return CurrentToken();
+        }
         char c;
         input_.get(c);
         if (c == '#') {
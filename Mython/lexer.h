@@ -1,17 +1,23 @@
 #pragma once
 
+#include <cstdint>
 #include <iosfwd>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <variant>
+#include <vector>
 
 namespace parse {
 
     namespace token_type {
-        struct Number {  //  
-            int value;   // 
+        struct Number {          //  
+            std::int64_t value;  // 
+        };
+
+        struct Float {     //     
+            double value;  // 
         };
 
         struct Id {             //  
@@ -39,6 +45,11 @@ namespace parse {
         struct And {};     //  and
         struct Or {};      //  or
         struct Not {};     //  not
+        struct In {};      //  in
+        struct While {};     //  while
+        struct For {};       //  for
+        struct Break {};     //  break
+        struct Continue {};  //  continue
         struct Eq {};      //  ==
         struct NotEq {};   //  !=
         struct LessOrEq {};     //  <=
@@ -49,10 +60,11 @@ namespace parse {
     }  // namespace token_type
 
     using TokenBase
-        = std::variant<token_type::Number, token_type::Id, token_type::Char, token_type::String,
+        = std::variant<token_type::Number, token_type::Float, token_type::Id, token_type::Char, token_type::String,
         token_type::Class, token_type::Return, token_type::If, token_type::Else,
         token_type::Def, token_type::Newline, token_type::Print, token_type::Indent,
-        token_type::Dedent, token_type::And, token_type::Or, token_type::Not,
+        token_type::Dedent, token_type::And, token_type::Or, token_type::Not, token_type::In,
+        token_type::While, token_type::For, token_type::Break, token_type::Continue,
         token_type::Eq, token_type::NotEq, token_type::LessOrEq, token_type::GreaterOrEq,
         token_type::None, token_type::True, token_type::False, token_type::Eof>;
 
@@ -89,6 +101,20 @@ namespace parse {
     public:
         explicit Lexer(std::istream& input);
 
+        //  ,     
+        // (,  TokenizeParallel).  token_type::Eof   
+        explicit Lexer(std::vector<Token> tokens);
+
+        //  true,      
+        [[nodiscard]] bool ReplaysTokens() const;
+
+        //           .
+        //     Newline,    .
+        //   ,   ,      .
+        //        ,    Newline   .
+        //      LexerError
+        std::string SkipIndentedBlock();
+
         //       token_type::Eof,    
         [[nodiscard]] const Token& CurrentToken() const;
 
@@ -124,6 +150,10 @@ namespace parse {
         //       LexerError
         template <typename T>
         const T& ExpectNext() {
+            if (replay_) {
+                NextToken();
+                return Expect<T>();
+            }
             char c;
             input_.get(c);
             if (c == ' ' && TimeToCountInDedents == false) {
@@ -147,6 +177,11 @@ namespace parse {
         template <typename T, typename U>
         void ExpectNext(const U& value) {
             using namespace std::literals;
+            if (replay_) {
+                NextToken();
+                Expect<T>(value);
+                return;
+            }
             char c;
             input_.get(c);
             if (c == ' ' && TimeToCountInDedents == false) {
@@ -170,6 +205,7 @@ namespace parse {
         void SetToken();
         void ParseIds();
        // void ParseNumbers();
+        void ParseFloat(std::string text);
         void ParseString();
         void ParseCharLogicOPerations();
         bool CheckIds(std::string s) const;
@@ -178,6 +214,11 @@ namespace parse {
         bool TimeToCountInDedents=true;
         bool FirstConstruct = true;
         bool CommentFlag = false;
+        //     
+        std::istringstream empty_input_;
+        std::vector<Token> tokens_;
+        size_t token_pos_ = 0;
+        bool replay_ = false;
     };
 
 }  // namespace parse
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include "load_client.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+namespace server {
+
+    Client::Client(const string& socket_path)
+        : socket_(net::LocalSocket::Connect(socket_path)) {
+    }
+
+    Response Client::Execute(string_view program, string_view input) {
+        net::SendFrame(socket_, net::FrameType::Program, program);
+        net::SendFrame(socket_, net::FrameType::Input, input);
+
+        Response response;
+        net::FrameType type;
+        string data;
+        while (net::ReceiveFrame(socket_, type, data)) {
+            switch (type) {
+            case net::FrameType::Output:
+                response.output += data;
+                break;
+            case net::FrameType::Done:
+                response.ok = true;
+                return response;
+            case net::FrameType::Error:
+                response.error = std::move(data);
+                return response;
+            default:
+                throw net::SocketError("Unexpected frame from server"s);
+            }
+        }
+        throw net::SocketError("Server closed the connection"s);
+    }
+
+    LatencyHistogram::LatencyHistogram()
+        : buckets_(SUB_BUCKETS * OCTAVES, 0) {
+    }
+
+    size_t LatencyHistogram::BucketIndex(uint64_t microseconds) {
+        if (microseconds < SUB_BUCKETS) {
+            return static_cast<size_t>(microseconds);
+        }
+        //  -   ,      SUB_BUCKETS  
+        size_t octave = 0;
+        while ((microseconds >> (octave + 1)) >= SUB_BUCKETS) {
+            ++octave;
+        }
+        const size_t sub = static_cast<size_t>((microseconds >> octave) - SUB_BUCKETS);
+        return min(SUB_BUCKETS * (octave + 2) + sub - SUB_BUCKETS, SUB_BUCKETS * OCTAVES - 1);
+    }
+
+    uint64_t LatencyHistogram::BucketUpperBound(size_t index) {
+        if (index < SUB_BUCKETS) {
+            return index + 1;
+        }
+        const size_t octave = index / SUB_BUCKETS - 1;
+        const size_t sub = index % SUB_BUCKETS;
+        return (static_cast<uint64_t>(SUB_BUCKETS + sub + 1) << octave);
+    }
+
+    void LatencyHistogram::Record(Duration latency) {
+        const auto microseconds = static_cast<uint64_t>(max<int64_t>(chrono::duration_cast<chrono::microseconds>(latency).count(), 0));
+        ++buckets_[BucketIndex(microseconds)];
+        ++count_;
+        max_ = max(max_, latency);
+        total_ += latency;
+    }
+
+    void LatencyHistogram::Merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < buckets_.size(); ++i) {
+            buckets_[i] += other.buckets_[i];
+        }
+        count_ += other.count_;
+        max_ = max(max_, other.max_);
+        total_ += other.total_;
+    }
+
+    uint64_t LatencyHistogram::GetCount() const {
+        return count_;
+    }
+
+    LatencyHistogram::Duration LatencyHistogram::GetMax() const {
+        return max_;
+    }
+
+    LatencyHistogram::Duration LatencyHistogram::GetMean() const {
+        return count_ != 0 ? total_ / static_cast<int64_t>(count_) : Duration{};
+    }
+
+    LatencyHistogram::Duration LatencyHistogram::Percentile(double percentile) const {
+        if (count_ == 0) {
+            return {};
+        }
+        const auto target = static_cast<uint64_t>(clamp(percentile, 0.0, 1.0) * static_cast<double>(count_));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < buckets_.size(); ++i) {
+            seen += buckets_[i];
+            if (seen > target || seen == count_) {
+                return min<Duration>(chrono::microseconds(BucketUpperBound(i)), max_);
+            }
+        }
+        return max_;
+    }
+
+    void LatencyHistogram::Print(ostream& out) const {
+        auto us = [](Duration d) {
+            return chrono::duration<double, micro>(d).count();
+        };
+        out << fixed << setprecision(1);
+        out << "requests "s << count_ << "  mean "s << us(GetMean()) << " us  max "s << us(max_) << " us"s << endl;
+        for (double p : { 0.5, 0.9, 0.99, 0.999 }) {
+            out << "  p"s << setw(5) << left << p * 100 << right << setw(10) << us(Percentile(p)) << " us"s << endl;
+        }
+        const uint64_t peak = count_ != 0 ? *max_element(buckets_.begin(), buckets_.end()) : 0;
+        for (size_t i = 0; i < buckets_.size(); ++i) {
+            if (buckets_[i] == 0) {
+                continue;
+            }
+            const size_t width = static_cast<size_t>(50 * buckets_[i] / peak);
+            out << "  < "s << setw(10) << BucketUpperBound(i) << " us "s << setw(8) << buckets_[i] << ' '
+                << string(max<size_t>(width, 1), '#') << endl;
+        }
+    }
+
+    double LoadReport::Throughput() const {
+        const chrono::duration<double> seconds = wall_time;
+        return seconds.count() > 0 ? static_cast<double>(latencies.GetCount() + failed) / seconds.count() : 0.0;
+    }
+
+    LoadReport RunLoad(const LoadOptions& options) {
+        LoadReport report;
+        mutex report_mutex;
+        atomic<size_t> next_request{ 0 };
+
+        const size_t connections = max<size_t>(options.connections, 1);
+        const auto start = chrono::steady_clock::now();
+
+        auto worker = [&]() {
+            LatencyHistogram latencies;
+            size_t failed = 0;
+            string first_error;
+            try {
+                Client client(options.socket_path);
+                while (next_request++ < options.requests) {
+                    const auto request_start = chrono::steady_clock::now();
+                    Response response = client.Execute(options.program, options.input);
+                    latencies.Record(chrono::steady_clock::now() - request_start);
+                    if (!response.ok) {
+                        ++failed;
+                        if (first_error.empty()) {
+                            first_error = std::move(response.error);
+                        }
+                    }
+                }
+            }
+            catch (const exception& e) {
+                ++failed;
+                first_error = e.what();
+            }
+
+            lock_guard guard(report_mutex);
+            report.latencies.Merge(latencies);
+            report.failed += failed;
+            if (report.first_error.empty()) {
+                report.first_error = std::move(first_error);
+            }
+        };
+
+        vector<thread> threads;
+        for (size_t i = 1; i < connections; ++i) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& t : threads) {
+            t.join();
+        }
+        report.wall_time = chrono::steady_clock::now() - start;
+        return report;
+    }
+
+}  // namespace server
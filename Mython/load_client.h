@@ -0,0 +1,89 @@
+#pragma once
+
+#include "local_socket.h"
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace server {
+
+    //     
+    struct Response {
+        bool ok = false;
+        std::string output;
+        //  ,  ok == false
+        std::string error;
+    };
+
+    //  .  ,   
+    class Client {
+    public:
+        explicit Client(const std::string& socket_path);
+
+        Response Execute(std::string_view program, std::string_view input = {});
+
+    private:
+        net::LocalSocket socket_;
+    };
+
+    //     :     
+    //  SUB_BUCKETS ,      1/SUB_BUCKETS
+    class LatencyHistogram {
+    public:
+        using Duration = std::chrono::nanoseconds;
+
+        LatencyHistogram();
+
+        void Record(Duration latency);
+        void Merge(const LatencyHistogram& other);
+
+        [[nodiscard]] uint64_t GetCount() const;
+        [[nodiscard]] Duration GetMax() const;
+        [[nodiscard]] Duration GetMean() const;
+        // ,     percentile  ( 0  1),    
+        [[nodiscard]] Duration Percentile(double percentile) const;
+
+        //         
+        void Print(std::ostream& out) const;
+
+    private:
+        static const size_t SUB_BUCKETS = 8;
+        static const size_t OCTAVES = 40;
+
+        static size_t BucketIndex(uint64_t microseconds);
+        static uint64_t BucketUpperBound(size_t index);
+
+        std::vector<uint64_t> buckets_;
+        uint64_t count_ = 0;
+        Duration max_{};
+        Duration total_{};
+    };
+
+    struct LoadOptions {
+        std::string socket_path;
+        std::string program;
+        std::string input;
+        //   ,    
+        size_t connections = 4;
+        //   
+        size_t requests = 1000;
+    };
+
+    struct LoadReport {
+        LatencyHistogram latencies;
+        std::chrono::steady_clock::duration wall_time{};
+        size_t failed = 0;
+        //   ,    
+        std::string first_error;
+
+        [[nodiscard]] double Throughput() const;
+    };
+
+    //  :        
+    LoadReport RunLoad(const LoadOptions& options);
+
+}  // namespace server
@@ -0,0 +1,197 @@
+#include "local_socket.h"
+
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <afunix.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace net {
+
+    namespace {
+#ifdef _WIN32
+        // Winsock     
+        void EnsureInitialized() {
+            static const bool initialized = []() {
+                WSADATA data;
+                if (WSAStartup(MAKEWORD(2, 2), &data) != 0) {
+                    throw SocketError("WSAStartup failed"s);
+                }
+                return true;
+            }();
+            (void)initialized;
+        }
+
+        void CloseHandle(uintptr_t handle) {
+            closesocket(static_cast<SOCKET>(handle));
+        }
+
+        const int SEND_FLAGS = 0;
+        const int SHUTDOWN_BOTH = SD_BOTH;
+#else
+        void EnsureInitialized() {
+        }
+
+        void CloseHandle(int handle) {
+            close(handle);
+        }
+
+        //          SIGPIPE
+        const int SEND_FLAGS = MSG_NOSIGNAL;
+        const int SHUTDOWN_BOTH = SHUT_RDWR;
+#endif
+
+        sockaddr_un MakeAddress(const string& path) {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            if (path.size() >= sizeof(address.sun_path)) {
+                throw SocketError("Socket path is too long: "s + path);
+            }
+            memcpy(address.sun_path, path.c_str(), path.size() + 1);
+            return address;
+        }
+    }  // namespace
+
+#ifdef _WIN32
+    const LocalSocket::Handle LocalSocket::INVALID = static_cast<Handle>(INVALID_SOCKET);
+#else
+    const LocalSocket::Handle LocalSocket::INVALID = -1;
+#endif
+
+    LocalSocket::LocalSocket(Handle handle)
+        : handle_(handle) {
+    }
+
+    LocalSocket::~LocalSocket() {
+        Close();
+    }
+
+    LocalSocket::LocalSocket(LocalSocket&& other) noexcept
+        : handle_(std::exchange(other.handle_, INVALID)) {
+    }
+
+    LocalSocket& LocalSocket::operator=(LocalSocket&& other) noexcept {
+        if (this != &other) {
+            Close();
+            handle_ = std::exchange(other.handle_, INVALID);
+        }
+        return *this;
+    }
+
+    void LocalSocket::Close() {
+        if (handle_ != INVALID) {
+            CloseHandle(handle_);
+            handle_ = INVALID;
+        }
+    }
+
+    LocalSocket LocalSocket::Listen(const string& path, int backlog) {
+        EnsureInitialized();
+        const sockaddr_un address = MakeAddress(path);
+        LocalSocket result(static_cast<Handle>(socket(AF_UNIX, SOCK_STREAM, 0)));
+        if (!result.IsValid()) {
+            throw SocketError("Can't create socket"s);
+        }
+        remove(path.c_str());
+        if (::bind(result.handle_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+            throw SocketError("Can't bind socket to "s + path);
+        }
+        if (listen(result.handle_, backlog) != 0) {
+            throw SocketError("Can't listen on "s + path);
+        }
+        return result;
+    }
+
+    LocalSocket LocalSocket::Connect(const string& path) {
+        EnsureInitialized();
+        const sockaddr_un address = MakeAddress(path);
+        LocalSocket result(static_cast<Handle>(socket(AF_UNIX, SOCK_STREAM, 0)));
+        if (!result.IsValid()) {
+            throw SocketError("Can't create socket"s);
+        }
+        if (connect(result.handle_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+            throw SocketError("Can't connect to "s + path);
+        }
+        return result;
+    }
+
+    LocalSocket LocalSocket::Accept() {
+        return LocalSocket(static_cast<Handle>(accept(handle_, nullptr, nullptr)));
+    }
+
+    void LocalSocket::SendAll(string_view data) {
+        while (!data.empty()) {
+            const auto sent = send(handle_, data.data(), static_cast<int>(data.size()), SEND_FLAGS);
+            if (sent <= 0) {
+                throw SocketError("Connection closed while sending"s);
+            }
+            data.remove_prefix(static_cast<size_t>(sent));
+        }
+    }
+
+    bool LocalSocket::ReceiveExactly(char* data, size_t size) {
+        size_t received = 0;
+        while (received < size) {
+            const auto count = recv(handle_, data + received, static_cast<int>(size - received), 0);
+            if (count <= 0) {
+                if (received == 0) {
+                    return false;
+                }
+                throw SocketError("Connection closed in the middle of a frame"s);
+            }
+            received += static_cast<size_t>(count);
+        }
+        return true;
+    }
+
+    void LocalSocket::Shutdown() {
+        if (handle_ != INVALID) {
+            shutdown(handle_, SHUTDOWN_BOTH);
+        }
+    }
+
+    bool LocalSocket::IsValid() const {
+        return handle_ != INVALID;
+    }
+
+    void SendFrame(LocalSocket& socket, FrameType type, string_view data) {
+        const auto size = static_cast<uint32_t>(data.size());
+        char header[5] = {
+            static_cast<char>(type),
+            static_cast<char>(size & 0xFF),
+            static_cast<char>((size >> 8) & 0xFF),
+            static_cast<char>((size >> 16) & 0xFF),
+            static_cast<char>((size >> 24) & 0xFF),
+        };
+        socket.SendAll({ header, sizeof(header) });
+        socket.SendAll(data);
+    }
+
+    bool ReceiveFrame(LocalSocket& socket, FrameType& type, string& data, size_t max_size) {
+        unsigned char header[5];
+        if (!socket.ReceiveExactly(reinterpret_cast<char*>(header), sizeof(header))) {
+            return false;
+        }
+        type = static_cast<FrameType>(header[0]);
+        const uint32_t size = header[1] | (header[2] << 8) | (header[3] << 16) | (static_cast<uint32_t>(header[4]) << 24);
+        if (size > max_size) {
+            throw FrameTooLarge("Frame of "s + to_string(size) + " bytes exceeds the limit of "s + to_string(max_size));
+        }
+        data.resize(size);
+        if (size != 0 && !socket.ReceiveExactly(data.data(), size)) {
+            throw SocketError("Connection closed in the middle of a frame"s);
+        }
+        return true;
+    }
+
+}  // namespace net
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace net {
+
+    struct SocketError : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    //     .    ,  
+    //   
+    struct FrameTooLarge : SocketError {
+        using SocketError::SocketError;
+    };
+
+    //   Unix (AF_UNIX).  Windows   AF_UNIX  Winsock.
+    //       
+    class LocalSocket {
+    public:
+        LocalSocket() = default;
+        ~LocalSocket();
+
+        LocalSocket(LocalSocket&& other) noexcept;
+        LocalSocket& operator=(LocalSocket&& other) noexcept;
+        LocalSocket(const LocalSocket&) = delete;
+        LocalSocket& operator=(const LocalSocket&) = delete;
+
+        //      path,       
+        static LocalSocket Listen(const std::string& path, int backlog = 128);
+        static LocalSocket Connect(const std::string& path);
+
+        //   .   ,       Shutdown
+        LocalSocket Accept();
+
+        //   .  SocketError,   
+        void SendAll(std::string_view data);
+        //   size .  false,      
+        bool ReceiveExactly(char* data, size_t size);
+
+        //      ,   
+        void Shutdown();
+
+        [[nodiscard]] bool IsValid() const;
+
+    private:
+#ifdef _WIN32
+        using Handle = uintptr_t;
+#else
+        using Handle = int;
+#endif
+        explicit LocalSocket(Handle handle);
+        void Close();
+
+        static const Handle INVALID;
+        Handle handle_ = INVALID;
+    };
+
+    //    
+    enum class FrameType : char {
+        // :  
+        Program = 'P',
+        // :  ,     stdin
+        Input = 'I',
+        // :   
+        Output = 'O',
+        // :   ,  -  
+        Error = 'E',
+        // :   
+        Done = 'D',
+    };
+
+    // :  (1 ),   (4 , little-endian)  
+    void SendFrame(LocalSocket& socket, FrameType type, std::string_view data);
+    //  false,     .     
+    // max_size,  FrameTooLarge,     
+    bool ReceiveFrame(LocalSocket& socket, FrameType& type, std::string& data, size_t max_size = UINT32_MAX);
+
+}  // namespace net
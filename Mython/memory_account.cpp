@@ -0,0 +1,118 @@
+#include "memory_account.h"
+
+#include <algorithm>
+#include <utility>
+
+using namespace std;
+
+namespace runtime {
+
+    string_view GetMemoryKindName(MemoryKind kind) {
+        switch (kind) {
+        case MemoryKind::Number:
+            return "Number"sv;
+        case MemoryKind::String:
+            return "String"sv;
+        case MemoryKind::Bool:
+            return "Bool"sv;
+        case MemoryKind::Instance:
+            return "Instance"sv;
+        case MemoryKind::Class:
+            return "Class"sv;
+        case MemoryKind::Closure:
+            return "Closure"sv;
+        case MemoryKind::List:
+            return "List"sv;
+        case MemoryKind::Dict:
+            return "Dict"sv;
+        case MemoryKind::Other:
+            break;
+        }
+        return "Other"sv;
+    }
+
+    MemoryAccount::MemoryAccount(size_t limit)
+        : limit_(limit) {
+    }
+
+    void MemoryAccount::Allocate(MemoryKind kind, size_t bytes) {
+        const size_t live = live_bytes_.fetch_add(bytes, memory_order_relaxed) + bytes;
+        if (live > limit_ || live < bytes) {
+            live_bytes_.fetch_sub(bytes, memory_order_relaxed);
+            throw MemoryLimitExceeded();
+        }
+        size_t peak = peak_bytes_.load(memory_order_relaxed);
+        while (live > peak && !peak_bytes_.compare_exchange_weak(peak, live, memory_order_relaxed)) {
+        }
+        auto& counters = kinds_[static_cast<size_t>(kind)];
+        counters.allocations.fetch_add(1, memory_order_relaxed);
+        counters.live_bytes.fetch_add(bytes, memory_order_relaxed);
+    }
+
+    void MemoryAccount::Release(MemoryKind kind, size_t bytes) noexcept {
+        live_bytes_.fetch_sub(bytes, memory_order_relaxed);
+        kinds_[static_cast<size_t>(kind)].live_bytes.fetch_sub(bytes, memory_order_relaxed);
+    }
+
+    void MemoryAccount::CheckAvailable(size_t bytes) const {
+        if (bytes > limit_ - min(limit_, live_bytes_.load(memory_order_relaxed))) {
+            throw MemoryLimitExceeded();
+        }
+    }
+
+    size_t MemoryAccount::GetLimit() const {
+        return limit_;
+    }
+
+    MemoryStats MemoryAccount::GetStats() const {
+        MemoryStats stats;
+        stats.live_bytes = live_bytes_.load(memory_order_relaxed);
+        stats.peak_bytes = peak_bytes_.load(memory_order_relaxed);
+        for (size_t i = 0; i < MEMORY_KIND_COUNT; ++i) {
+            stats.kinds[i].allocations = kinds_[i].allocations.load(memory_order_relaxed);
+            stats.kinds[i].live_bytes = kinds_[i].live_bytes.load(memory_order_relaxed);
+            stats.allocations += stats.kinds[i].allocations;
+        }
+        return stats;
+    }
+
+    MemoryAccount::Scope::Scope(shared_ptr<MemoryAccount> account)
+        : account_(move(account))
+        , previous_(detail::current_memory_account) {
+        detail::current_memory_account = account_ ? &account_ : nullptr;
+    }
+
+    MemoryAccount::Scope::~Scope() {
+        detail::current_memory_account = previous_;
+    }
+
+    MemoryCharge::MemoryCharge(MemoryKind kind)
+        : account_(MemoryAccount::Current())
+        , kind_(kind) {
+    }
+
+    MemoryCharge::MemoryCharge(const MemoryCharge& other)
+        : account_(MemoryAccount::Current())
+        , kind_(other.kind_) {
+    }
+
+    MemoryCharge::MemoryCharge(MemoryCharge&& other) noexcept
+        : account_(other.account_)
+        , kind_(other.kind_)
+        , bytes_(exchange(other.bytes_, 0)) {
+    }
+
+    MemoryCharge::~MemoryCharge() {
+        if (bytes_ != 0) {
+            account_->Release(kind_, bytes_);
+        }
+    }
+
+    void MemoryCharge::Add(size_t bytes) {
+        if (account_ != nullptr) {
+            account_->Allocate(kind_, bytes);
+            bytes_ += bytes;
+        }
+    }
+
+}  // namespace runtime
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <string_view>
+
+namespace runtime {
+
+    // ,      ,  .
+    //   FuelExhausted,    runtime_error:   ,    
+    class MemoryLimitExceeded : public std::exception {
+    public:
+        [[nodiscard]] const char* what() const noexcept override {
+            return "Memory limit exceeded";
+        }
+    };
+
+    //   
+    enum class MemoryKind {
+        Number,
+        String,
+        Bool,
+        Instance,
+        Class,
+        //      
+        Closure,
+        //    
+        List,
+        Dict,
+        Other,
+    };
+
+    inline constexpr size_t MEMORY_KIND_COUNT = static_cast<size_t>(MemoryKind::Other) + 1;
+
+    [[nodiscard]] std::string_view GetMemoryKindName(MemoryKind kind);
+
+    struct MemoryKindStats {
+        size_t allocations = 0;
+        size_t live_bytes = 0;
+    };
+
+    struct MemoryStats {
+        size_t live_bytes = 0;
+        size_t peak_bytes = 0;
+        size_t allocations = 0;
+        std::array<MemoryKindStats, MEMORY_KIND_COUNT> kinds{};
+
+        [[nodiscard]] const MemoryKindStats& operator[](MemoryKind kind) const {
+            return kinds[static_cast<size_t>(kind)];
+        }
+    };
+
+    //    :    ,     
+    //    .     MemoryAccount::Scope, ,
+    //   ObjectHolder::Own,  ,    
+    //  ,      .    ,
+    //     std::make_shared  ,       .
+    //      
+    class MemoryAccount {
+    public:
+        static constexpr size_t UNLIMITED = std::numeric_limits<size_t>::max();
+
+        explicit MemoryAccount(size_t limit = UNLIMITED);
+
+        MemoryAccount(const MemoryAccount&) = delete;
+        MemoryAccount& operator=(const MemoryAccount&) = delete;
+
+        //  bytes .    ,   
+        //   MemoryLimitExceeded
+        void Allocate(MemoryKind kind, size_t bytes);
+        void Release(MemoryKind kind, size_t bytes) noexcept;
+        //  MemoryLimitExceeded,   bytes     
+        void CheckAvailable(size_t bytes) const;
+
+        [[nodiscard]] size_t GetLimit() const;
+        [[nodiscard]] MemoryStats GetStats() const;
+
+        // ,    ,  nullptr
+        [[nodiscard]] static MemoryAccount* Current();
+        [[nodiscard]] static const std::shared_ptr<MemoryAccount>* CurrentOwner();
+
+        //         
+        class Scope {
+        public:
+            explicit Scope(std::shared_ptr<MemoryAccount> account);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            std::shared_ptr<MemoryAccount> account_;
+            const std::shared_ptr<MemoryAccount>* previous_;
+        };
+
+    private:
+        struct KindCounters {
+            std::atomic<size_t> allocations{ 0 };
+            std::atomic<size_t> live_bytes{ 0 };
+        };
+
+        const size_t limit_;
+        std::atomic<size_t> live_bytes_{ 0 };
+        std::atomic<size_t> peak_bytes_{ 0 };
+        std::array<KindCounters, MEMORY_KIND_COUNT> kinds_;
+    };
+
+    namespace detail {
+        inline thread_local const std::shared_ptr<MemoryAccount>* current_memory_account = nullptr;
+    }
+
+    inline MemoryAccount* MemoryAccount::Current() {
+        return detail::current_memory_account != nullptr ? detail::current_memory_account->get() : nullptr;
+    }
+
+    inline const std::shared_ptr<MemoryAccount>* MemoryAccount::CurrentOwner() {
+        return detail::current_memory_account;
+    }
+
+    //   std::allocate_shared,       extra_bytes,
+    //      (,  )
+    template <typename T>
+    class AccountingAllocator {
+    public:
+        using value_type = T;
+
+        AccountingAllocator(std::shared_ptr<MemoryAccount> account, MemoryKind kind, size_t extra_bytes)
+            : account_(std::move(account))
+            , kind_(kind)
+            , extra_bytes_(extra_bytes) {
+        }
+
+        template <typename U>
+        AccountingAllocator(const AccountingAllocator<U>& other) noexcept  // NOLINT(google-explicit-constructor)
+            : account_(other.account_)
+            , kind_(other.kind_)
+            , extra_bytes_(other.extra_bytes_) {
+        }
+
+        T* allocate(size_t n) {
+            account_->Allocate(kind_, n * sizeof(T) + extra_bytes_);
+            try {
+                return static_cast<T*>(::operator new(n * sizeof(T)));
+            }
+            catch (...) {
+                account_->Release(kind_, n * sizeof(T) + extra_bytes_);
+                throw;
+            }
+        }
+
+        void deallocate(T* ptr, size_t n) noexcept {
+            ::operator delete(ptr);
+            account_->Release(kind_, n * sizeof(T) + extra_bytes_);
+        }
+
+        template <typename U>
+        bool operator==(const AccountingAllocator<U>& other) const noexcept {
+            return account_ == other.account_;
+        }
+
+        template <typename U>
+        bool operator!=(const AccountingAllocator<U>& other) const noexcept {
+            return !(*this == other);
+        }
+
+    private:
+        template <typename U>
+        friend class AccountingAllocator;
+
+        std::shared_ptr<MemoryAccount> account_;
+        MemoryKind kind_;
+        size_t extra_bytes_;
+    };
+
+    // ,       ,    . 
+    //  ,     MemoryCharge. ,    , 
+    //  ,   ,    :     
+    class MemoryCharge {
+    public:
+        explicit MemoryCharge(MemoryKind kind = MemoryKind::Closure);
+        MemoryCharge(const MemoryCharge& other);
+        MemoryCharge(MemoryCharge&& other) noexcept;
+        MemoryCharge& operator=(const MemoryCharge&) = delete;
+        MemoryCharge& operator=(MemoryCharge&&) = delete;
+        ~MemoryCharge();
+
+        //  bytes   ,   .     
+        void Add(size_t bytes);
+
+    private:
+        MemoryAccount* account_;
+        MemoryKind kind_;
+        size_t bytes_ = 0;
+    };
+
+}  // namespace runtime
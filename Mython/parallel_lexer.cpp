@@ -0,0 +1,151 @@
+#include "parallel_lexer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <sstream>
+#include <thread>
+
+using namespace std;
+
+namespace parse {
+
+    namespace {
+        //      ,    
+        // -   
+        const size_t CHUNKS_PER_THREAD = 4;
+
+        bool IsTopLevelLineStart(string_view source, size_t pos) {
+            if (pos >= source.size() || (pos != 0 && source[pos - 1] != '\n')) {
+                return false;
+            }
+            const char c = source[pos];
+            if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '#') {
+                return false;
+            }
+            // else      
+            if (source.substr(pos, 4) == "else"sv) {
+                if (pos + 4 == source.size()) {
+                    return false;
+                }
+                const char next = source[pos + 4];
+                if (next == ':' || next == ' ') {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        //         from
+        size_t FindTopLevelLineStart(string_view source, size_t from) {
+            size_t pos = from;
+            while (pos < source.size()) {
+                if (IsTopLevelLineStart(source, pos)) {
+                    return pos;
+                }
+                pos = source.find('\n', pos);
+                if (pos == string_view::npos) {
+                    break;
+                }
+                ++pos;
+            }
+            return source.size();
+        }
+
+        vector<Token> TokenizeChunk(string_view chunk, bool is_last) {
+            istringstream input{ string(chunk) };
+            vector<Token> tokens = Tokenize(input);
+            // Eof      
+            if (!is_last) {
+                tokens.pop_back();
+            }
+            return tokens;
+        }
+    }  // namespace
+
+    vector<Token> Tokenize(istream& input) {
+        Lexer lexer(input);
+        vector<Token> tokens;
+        tokens.push_back(lexer.CurrentToken());
+        while (!tokens.back().Is<token_type::Eof>()) {
+            tokens.push_back(lexer.NextToken());
+        }
+        return tokens;
+    }
+
+    vector<size_t> SplitAtTopLevel(string_view source, size_t max_chunks, size_t min_chunk_size) {
+        vector<size_t> starts{ 0 };
+        if (max_chunks < 2) {
+            return starts;
+        }
+        const size_t target_size = max(source.size() / max_chunks, min_chunk_size);
+        while (starts.size() < max_chunks) {
+            const size_t from = starts.back() + max<size_t>(target_size, 1);
+            if (from >= source.size()) {
+                break;
+            }
+            const size_t pos = FindTopLevelLineStart(source, from);
+            if (pos >= source.size()) {
+                break;
+            }
+            starts.push_back(pos);
+        }
+        return starts;
+    }
+
+    vector<Token> TokenizeParallel(const string& source, size_t thread_count, size_t min_chunk_size) {
+        if (thread_count == 0) {
+            thread_count = max(thread::hardware_concurrency(), 1u);
+        }
+        const string_view text = source;
+        const vector<size_t> starts = SplitAtTopLevel(text, thread_count * CHUNKS_PER_THREAD, min_chunk_size);
+        const size_t chunk_count = starts.size();
+
+        vector<vector<Token>> results(chunk_count);
+        vector<exception_ptr> errors(chunk_count);
+        atomic<size_t> next_chunk{ 0 };
+
+        auto worker = [&]() {
+            for (size_t i = next_chunk++; i < chunk_count; i = next_chunk++) {
+                const size_t begin = starts[i];
+                const size_t end = i + 1 < chunk_count ? starts[i + 1] : text.size();
+                try {
+                    results[i] = TokenizeChunk(text.substr(begin, end - begin), i + 1 == chunk_count);
+                }
+                catch (...) {
+                    errors[i] = current_exception();
+                }
+            }
+        };
+
+        vector<thread> threads;
+        const size_t extra_threads = min(thread_count, chunk_count) - 1;
+        threads.reserve(extra_threads);
+        for (size_t i = 0; i < extra_threads; ++i) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        //      ,      
+        for (const auto& error : errors) {
+            if (error) {
+                rethrow_exception(error);
+            }
+        }
+
+        size_t total = 0;
+        for (const auto& tokens : results) {
+            total += tokens.size();
+        }
+        vector<Token> tokens;
+        tokens.reserve(total);
+        for (auto& chunk_tokens : results) {
+            move(chunk_tokens.begin(), chunk_tokens.end(), back_inserter(tokens));
+        }
+        return tokens;
+    }
+
+}  // namespace parse
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "lexer.h"
+
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace parse {
+
+    //      .     token_type::Eof
+    std::vector<Token> Tokenize(std::istream& input);
+
+    //    ,     source   
+    // .        :   
+    //   ,        else.      0.
+    //   Mython     ,      
+    std::vector<size_t> SplitAtTopLevel(std::string_view source, size_t max_chunks, size_t min_chunk_size);
+
+    //  source    thread_count  (0 -   )   .
+    //     ,   Lexer,  source .
+    //   min_chunk_size    
+    std::vector<Token> TokenizeParallel(const std::string& source, size_t thread_count = 0,
+        size_t min_chunk_size = 64 * 1024);
+
+}  // namespace parse
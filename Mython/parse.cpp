@@ -1,8 +1,14 @@
 #include "parse.h"
 
+#include "dict.h"
 #include "lexer.h"
+#include "parallel_lexer.h"
 #include "statement.h"
 
+#include <mutex>
+#include <sstream>
+#include <utility>
+
 using namespace std;
 
 namespace TokenType = parse::token_type;
@@ -17,10 +23,25 @@ namespace {
         return !(token == c);
     }
 
+    //  ,        
+    struct ParseState {
+        runtime::Closure declared_classes;
+        //         
+        std::mutex lazy_parse_mutex;
+    };
+
     class Parser {
     public:
-        explicit Parser(parse::Lexer& lexer)
-            : lexer_(lexer) {
+        explicit Parser(parse::Lexer& lexer, MethodParsing method_parsing = MethodParsing::Eager)
+            : lexer_(lexer)
+            , method_parsing_(method_parsing)
+            , state_(make_shared<ParseState>()) {
+        }
+
+        Parser(parse::Lexer& lexer, MethodParsing method_parsing, shared_ptr<ParseState> state)
+            : lexer_(lexer)
+            , method_parsing_(method_parsing)
+            , state_(std::move(state)) {
         }
 
         // Program -> eps
@@ -34,6 +55,14 @@ namespace {
             return result;
         }
 
+        // MethodBody -> Suite
+        unique_ptr<ast::Statement> ParseMethodBody() {
+            const bool in_method = exchange(in_method_, true);
+            auto body = ParseSuite();
+            in_method_ = in_method;
+            return std::make_unique<ast::MethodBody>(std::move(body));
+        }
+
     private:
         // Suite -> NEWLINE INDENT (Statement)+ DEDENT
         unique_ptr<ast::Statement> ParseSuite()  // NOLINT
@@ -76,13 +105,56 @@ namespace {
                 lexer_.ExpectNext<TokenType::Char>(':');
                 lexer_.NextToken();
 
-                m.body = std::make_unique<ast::MethodBody>(ParseSuite());  // NOLINT
+                if (method_parsing_ == MethodParsing::Lazy) {
+                    m.body = SkipMethodBody();
+                }
+                else {
+                    // break  continue      ,    
+                    const int loop_depth = exchange(loop_depth_, 0);
+                    m.body = ParseMethodBody();  // NOLINT
+                    loop_depth_ = loop_depth;
+                }
 
                 result.push_back(std::move(m));
             }
             return result;
         }
 
+        //   ,   ,       .
+        //        Dedent,    ParseSuite
+        unique_ptr<ast::Statement> SkipMethodBody() {
+            lexer_.Expect<TokenType::Newline>();
+            if (!lexer_.ReplaysTokens()) {
+                string source = lexer_.SkipIndentedBlock();
+                lexer_.NextToken();
+                lexer_.Expect<TokenType::Dedent>();
+                lexer_.NextToken();
+                return make_unique<LazyMethodBody>(std::move(source), state_);
+            }
+
+            vector<parse::Token> tokens{ lexer_.CurrentToken() };
+            lexer_.ExpectNext<TokenType::Indent>();
+            tokens.push_back(lexer_.CurrentToken());
+
+            int depth = 1;
+            while (depth > 0) {
+                const auto& tok = lexer_.NextToken();
+                if (tok.Is<TokenType::Eof>()) {
+                    throw ParseError("Unexpected end of file in method body"s);
+                }
+                if (tok.Is<TokenType::Indent>()) {
+                    ++depth;
+                }
+                else if (tok.Is<TokenType::Dedent>()) {
+                    --depth;
+                }
+                tokens.push_back(tok);
+            }
+            lexer_.NextToken();
+
+            return make_unique<LazyMethodBody>(std::move(tokens), state_);
+        }
+
         // ClassDefinition -> Id ['(' Id ')'] : new_line indent MethodList dedent
         unique_ptr<ast::Statement> ParseClassDefinition()  // NOLINT
         {
@@ -96,8 +168,8 @@ namespace {
                 lexer_.ExpectNext<TokenType::Char>(')');
                 lexer_.NextToken();
 
-                auto it = declared_classes_.find(name);
-                if (it == declared_classes_.end()) {
+                auto it = state_->declared_classes.find(name);
+                if (it == state_->declared_classes.end()) {
                     throw ParseError("Base class "s + name + " not found for class "s + class_name);
                 }
                 base_class = static_cast<const runtime::Class*>(it->second.Get());  // NOLINT
@@ -112,16 +184,19 @@ namespace {
             lexer_.Expect<TokenType::Dedent>();
             lexer_.NextToken();
 
-            auto [it, inserted] = declared_classes_.insert({
+            auto cls = runtime::ObjectHolder::Own(runtime::Class(class_name, std::move(methods), base_class));
+            //    ClassDefinition.      ParseState,
+            //       
+            auto [it, inserted] = state_->declared_classes.insert({
                 class_name,
-                runtime::ObjectHolder::Own(runtime::Class(class_name, std::move(methods), base_class)),
+                runtime::ObjectHolder::Share(*cls),
                 });
 
             if (!inserted) {
                 throw ParseError("Class "s + class_name + " already exists"s);
             }
 
-            return make_unique<ast::ClassDefinition>(it->second);
+            return make_unique<ast::ClassDefinition>(std::move(cls));
         }
 
         vector<string> ParseDottedIds() {
@@ -135,11 +210,24 @@ namespace {
         }
 
         //  AssgnOrCall -> DottedIds = Expr
+        //               | DottedIds ['[' Expr ']']+ = Expr
         //               | DottedIds '(' ExprList ')'
         unique_ptr<ast::Statement> ParseAssignmentOrCall() {
             lexer_.Expect<TokenType::Id>();
 
             vector<string> id_list = ParseDottedIds();
+            if (lexer_.CurrentToken() == '[') {
+                //   -  ,    
+                unique_ptr<ast::Statement> object = make_unique<ast::VariableValue>(std::move(id_list));
+                unique_ptr<ast::Statement> index = ParseSubscript();
+                while (lexer_.CurrentToken() == '[') {
+                    object = make_unique<ast::Index>(std::move(object), std::move(index));
+                    index = ParseSubscript();
+                }
+                lexer_.Expect<TokenType::Char>('=');
+                lexer_.NextToken();
+                return make_unique<ast::IndexAssignment>(std::move(object), std::move(index), ParseTest());
+            }
             string last_name = id_list.back();
             id_list.pop_back();
 
@@ -213,8 +301,11 @@ namespace {
         //       | NONE
         //       | TRUE
         //       | FALSE
+        //       | '[' [ExprList] ']'
+        //       | '{' [Expr ':' Expr {',' Expr ':' Expr}] '}'
         //       | DottedIds '(' ExprList ')'
         //       | DottedIds
+        //       | Mult '[' Expr ']'
         unique_ptr<ast::Statement> ParseMult()  // NOLINT
         {
             if (lexer_.CurrentToken() == '(') {
@@ -229,10 +320,15 @@ namespace {
                 return make_unique<ast::Mult>(ParseMult(), make_unique<ast::NumericConst>(-1));
             }
             if (const auto* num = lexer_.CurrentToken().TryAs<TokenType::Number>()) {
-                int result = num->value;
+                int64_t result = num->value;
                 lexer_.NextToken();
                 return make_unique<ast::NumericConst>(result);
             }
+            if (const auto* num = lexer_.CurrentToken().TryAs<TokenType::Float>()) {
+                double result = num->value;
+                lexer_.NextToken();
+                return make_unique<ast::FloatConst>(result);
+            }
             if (const auto* str = lexer_.CurrentToken().TryAs<TokenType::String>()) {
                 string result = str->value;
                 lexer_.NextToken();
@@ -250,8 +346,61 @@ namespace {
                 lexer_.NextToken();
                 return make_unique<ast::None>();
             }
+            if (lexer_.CurrentToken() == '[') {
+                vector<unique_ptr<ast::Statement>> items;
+                if (lexer_.NextToken() != ']') {
+                    items = ParseTestList();
+                }
+                lexer_.Expect<TokenType::Char>(']');
+                lexer_.NextToken();
+                return ParseSubscripts(make_unique<ast::NewList>(std::move(items)));
+            }
+            if (lexer_.CurrentToken() == '{') {
+                vector<pair<unique_ptr<ast::Statement>, unique_ptr<ast::Statement>>> items;
+                if (lexer_.NextToken() != '}') {
+                    while (true) {
+                        auto key = ParseTest();
+                        lexer_.Expect<TokenType::Char>(':');
+                        lexer_.NextToken();
+                        items.emplace_back(std::move(key), ParseTest());
+                        if (lexer_.CurrentToken() != ',') {
+                            break;
+                        }
+                        lexer_.NextToken();
+                    }
+                }
+                lexer_.Expect<TokenType::Char>('}');
+                lexer_.NextToken();
+                return ParseSubscripts(make_unique<ast::NewDict>(std::move(items)));
+            }
+
+            return ParseSubscripts(ParseDottedIdsInMultExpr());
+        }
+
+        // Subscript -> '[' Expr ']'
+        unique_ptr<ast::Statement> ParseSubscript() {
+            lexer_.Expect<TokenType::Char>('[');
+            lexer_.NextToken();
+            auto result = ParseTest();
+            lexer_.Expect<TokenType::Char>(']');
+            lexer_.NextToken();
+            return result;
+        }
+
+        unique_ptr<ast::Statement> ParseSubscripts(unique_ptr<ast::Statement> object) {
+            while (lexer_.CurrentToken() == '[') {
+                object = make_unique<ast::Index>(std::move(object), ParseSubscript());
+            }
+            return object;
+        }
 
-            return ParseDottedIdsInMultExpr();
+        //     function
+        static unique_ptr<ast::Statement> TakeSingleArgument(const string& function,
+            vector<unique_ptr<ast::Statement>>& args) {
+            if (args.size() != 1) {
+                throw ParseError("Function "s + function + " takes exactly one argument"s);
+            }
+            return std::move(args.front());
         }
 
         std::unique_ptr<ast::Statement> ParseDottedIdsInMultExpr() {
@@ -274,15 +423,24 @@ namespace {
                         make_unique<ast::VariableValue>(std::move(names)), std::move(method_name),
                         std::move(args));
                 }
-                if (auto it = declared_classes_.find(method_name); it != declared_classes_.end()) {
+                if (auto it = state_->declared_classes.find(method_name); it != state_->declared_classes.end()) {
                     return make_unique<ast::NewInstance>(
                         static_cast<const runtime::Class&>(*it->second), std::move(args));  // NOLINT
                 }
                 if (method_name == "str"sv) {
-                    if (args.size() != 1) {
-                        throw ParseError("Function str takes exactly one argument"s);
-                    }
-                    return make_unique<ast::Stringify>(std::move(args.front()));
+                    return make_unique<ast::Stringify>(TakeSingleArgument(method_name, args));
+                }
+                if (method_name == "len"sv) {
+                    return make_unique<ast::Length>(TakeSingleArgument(method_name, args));
+                }
+                if (method_name == "sum"sv) {
+                    return make_unique<ast::Sum>(TakeSingleArgument(method_name, args));
+                }
+                if (method_name == "min"sv) {
+                    return make_unique<ast::Minimum>(TakeSingleArgument(method_name, args));
+                }
+                if (method_name == "max"sv) {
+                    return make_unique<ast::Maximum>(TakeSingleArgument(method_name, args));
                 }
                 throw ParseError("Unknown call to "s + method_name + "()"s);
             }
@@ -358,7 +516,16 @@ namespace {
             return ParseComparison();
         }
 
+        static bool In(const runtime::ObjectHolder& lhs, const runtime::ObjectHolder& rhs, runtime::Context& context) {
+            return runtime::Contains(rhs, lhs, context);
+        }
+
+        static bool NotIn(const runtime::ObjectHolder& lhs, const runtime::ObjectHolder& rhs, runtime::Context& context) {
+            return !runtime::Contains(rhs, lhs, context);
+        }
+
         // Comparison -> Expr [COMP_OP Expr]
+        // COMP_OP -> '<' | '>' | '==' | '!=' | '<=' | '>=' | in | not in
         unique_ptr<ast::Statement> ParseComparison()  // NOLINT
         {
             auto result = ParseExpression();
@@ -395,12 +562,84 @@ namespace {
                 return make_unique<ast::Comparison>(runtime::GreaterOrEqual, std::move(result),
                     ParseExpression());
             }
+            if (tok.Is<TokenType::In>()) {
+                lexer_.NextToken();
+                return make_unique<ast::Comparison>(In, std::move(result), ParseExpression());
+            }
+            if (tok.Is<TokenType::Not>()) {
+                lexer_.NextToken();
+                lexer_.Expect<TokenType::In>();
+                lexer_.NextToken();
+                return make_unique<ast::Comparison>(NotIn, std::move(result), ParseExpression());
+            }
             return result;
         }
 
+        // WhileLoop -> while LogicalExpr: Suite
+        unique_ptr<ast::Statement> ParseWhile()  // NOLINT
+        {
+            lexer_.Expect<TokenType::While>();
+            lexer_.NextToken();
+
+            auto condition = ParseTest();
+
+            lexer_.Expect<TokenType::Char>(':');
+            lexer_.NextToken();
+
+            return make_unique<ast::While>(std::move(condition), ParseLoopBody());
+        }
+
+        // ForLoop -> for id in range(Expr [, Expr [, Expr]]): Suite
+        //          | for id in Expr: Suite
+        unique_ptr<ast::Statement> ParseFor()  // NOLINT
+        {
+            lexer_.Expect<TokenType::For>();
+            string var = lexer_.ExpectNext<TokenType::Id>().value;
+            lexer_.ExpectNext<TokenType::In>();
+            lexer_.NextToken();
+
+            if (const auto* id = lexer_.CurrentToken().TryAs<TokenType::Id>(); id != nullptr && id->value == "range"sv) {
+                lexer_.ExpectNext<TokenType::Char>('(');
+                lexer_.NextToken();
+                vector<unique_ptr<ast::Statement>> args = ParseTestList();
+                lexer_.Expect<TokenType::Char>(')');
+                lexer_.ExpectNext<TokenType::Char>(':');
+                lexer_.NextToken();
+                if (args.size() > 3) {
+                    throw ParseError("Function range takes from one to three arguments"s);
+                }
+                // range(stop), range(start, stop)  range(start, stop, step)
+                unique_ptr<ast::Statement> start;
+                unique_ptr<ast::Statement> step;
+                if (args.size() == 3) {
+                    step = std::move(args[2]);
+                }
+                if (args.size() >= 2) {
+                    start = std::move(args[0]);
+                }
+                unique_ptr<ast::Statement> stop = std::move(args[args.size() == 1 ? 0 : 1]);
+                return make_unique<ast::ForRange>(std::move(var), std::move(start), std::move(stop),
+                    std::move(step), ParseLoopBody());
+            }
+
+            auto iterable = ParseTest();
+            lexer_.Expect<TokenType::Char>(':');
+            lexer_.NextToken();
+            return make_unique<ast::ForEach>(std::move(var), std::move(iterable), ParseLoopBody());
+        }
+
+        unique_ptr<ast::Statement> ParseLoopBody() {
+            ++loop_depth_;
+            auto body = ParseSuite();
+            --loop_depth_;
+            return body;
+        }
+
         // Statement -> SimpleStatement Newline
         //           | class ClassDefinition
         //           | if Condition
+        //           | while WhileLoop
+        //           | for ForLoop
         unique_ptr<ast::Statement> ParseStatement()  // NOLINT
         {
             const auto& tok = lexer_.CurrentToken();
@@ -412,6 +651,12 @@ namespace {
             if (tok.Is<TokenType::If>()) {
                 return ParseCondition();
             }
+            if (tok.Is<TokenType::While>()) {
+                return ParseWhile();
+            }
+            if (tok.Is<TokenType::For>()) {
+                return ParseFor();
+            }
             auto result = ParseSimpleStatement();
             lexer_.Expect<TokenType::Newline>();
             lexer_.NextToken();
@@ -420,11 +665,28 @@ namespace {
 
         // StatementBody -> return Expression
         //               | print ExpressionList
+        //               | break
+        //               | continue
         //               | AssignmentOrCall
         unique_ptr<ast::Statement> ParseSimpleStatement() {
             const auto& tok = lexer_.CurrentToken();
 
+            if (tok.Is<TokenType::Break>() || tok.Is<TokenType::Continue>()) {
+                const bool is_break = tok.Is<TokenType::Break>();
+                if (loop_depth_ == 0) {
+                    throw ParseError((is_break ? "break"s : "continue"s) + " outside loop"s);
+                }
+                lexer_.NextToken();
+                if (is_break) {
+                    return make_unique<ast::Break>();
+                }
+                return make_unique<ast::Continue>();
+            }
+
             if (tok.Is<TokenType::Return>()) {
+                if (!in_method_) {
+                    throw ParseError("return outside method"s);
+                }
                 lexer_.NextToken();
                 return make_unique<ast::Return>(ParseTest());
             }
@@ -439,12 +701,78 @@ namespace {
             return ParseAssignmentOrCall();
         }
 
+        //  ,          
+        class LazyMethodBody : public ast::Statement {
+        public:
+            LazyMethodBody(string source, shared_ptr<ParseState> state)
+                : source_(std::move(source))
+                , state_(std::move(state)) {
+            }
+
+            LazyMethodBody(vector<parse::Token> tokens, shared_ptr<ParseState> state)
+                : tokens_(std::move(tokens))
+                , state_(std::move(state)) {
+            }
+
+            runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override {
+                call_once(parsed_, [this]() {
+                    Parse();
+                });
+                return body_->Execute(closure, context);
+            }
+
+        private:
+            void Parse() {
+                //   ,   ,    ,
+                //          
+                const runtime::MemoryAccount::Scope no_account(nullptr);
+                vector<parse::Token> tokens = tokens_;
+                if (tokens.empty()) {
+                    istringstream input(source_);
+                    tokens.push_back(TokenType::Newline{});
+                    for (auto& token : parse::Tokenize(input)) {
+                        tokens.push_back(std::move(token));
+                    }
+                }
+
+                lock_guard guard(state_->lazy_parse_mutex);
+                parse::Lexer lexer(std::move(tokens));
+                body_ = Parser{ lexer, MethodParsing::Lazy, state_ }.ParseMethodBody();
+                lexer.Expect<TokenType::Eof>();
+
+                source_ = {};
+                tokens_ = {};
+            }
+
+            string source_;
+            vector<parse::Token> tokens_;
+            shared_ptr<ParseState> state_;
+            once_flag parsed_;
+            unique_ptr<ast::Statement> body_;
+        };
+
         parse::Lexer& lexer_;
-        runtime::Closure declared_classes_;
+        MethodParsing method_parsing_;
+        shared_ptr<ParseState> state_;
+        //  ,      
+        int loop_depth_ = 0;
+        //    : return    
+        bool in_method_ = false;
     };
 
 }  // namespace
 
-unique_ptr<runtime::Executable> ParseProgram(parse::Lexer& lexer) {
-    return Parser{ lexer }.ParseProgram();
+unique_ptr<runtime::Executable> ParseProgram(parse::Lexer& lexer, MethodParsing method_parsing) {
+    return Parser{ lexer, method_parsing }.ParseProgram();
+}
+
+unique_ptr<runtime::Executable> ParseProgram(parse::Lexer& lexer, const runtime::Closure& known_classes,
+    MethodParsing method_parsing) {
+    auto state = make_shared<ParseState>();
+    for (const auto& [name, value] : known_classes) {
+        if (auto* cls = value.TryAs<runtime::Class>()) {
+            state->declared_classes.emplace(name, runtime::ObjectHolder::Share(*cls));
+        }
+    }
+    return Parser{ lexer, method_parsing, std::move(state) }.ParseProgram();
 }
\ No newline at end of file
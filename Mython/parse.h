@@ -1,5 +1,7 @@
 #pragma once
 
+#include "runtime.h"
+
 #include <memory>
 #include <stdexcept>
 
@@ -7,12 +9,23 @@ namespace parse {
     class Lexer;
 }
 
-namespace runtime {
-    class Executable;
-}
-
 struct ParseError : std::runtime_error {
     using std::runtime_error::runtime_error;
 };
 
-std::unique_ptr<runtime::Executable> ParseProgram(parse::Lexer& lexer);
\ No newline at end of file
+// Eager -      .
+// Lazy -         Dedent,    .
+//      ,      
+//  .     ,      
+enum class MethodParsing {
+    Eager,
+    Lazy,
+};
+
+std::unique_ptr<runtime::Executable> ParseProgram(parse::Lexer& lexer,
+    MethodParsing method_parsing = MethodParsing::Eager);
+
+//  ,   ,     .
+//  known_classes     runtime::Class;     
+std::unique_ptr<runtime::Executable> ParseProgram(parse::Lexer& lexer, const runtime::Closure& known_classes,
+    MethodParsing method_parsing = MethodParsing::Eager);
\ No newline at end of file
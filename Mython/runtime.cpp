@@ -1,13 +1,23 @@
 #include "runtime.h"
 
+#include "dict.h"
+#include "frame_stack.h"
+
+#include <algorithm>
 #include <cassert>
 #include <optional>
 #include <sstream>
+#include <stdexcept>
+#include <tuple>
 
 using namespace std;
 
 namespace runtime {
 
+    namespace {
+        const string STR_METHOD = "__str__"s;
+    }  // namespace
+
     ObjectHolder::ObjectHolder(std::shared_ptr<Object> data)
         : data_(std::move(data)) {
     }
@@ -21,6 +31,10 @@ namespace runtime {
         return ObjectHolder(std::shared_ptr<Object>(&object, [](auto* /*p*/) {  /*do nothing*/  }));
     }
 
+    ObjectHolder ObjectHolder::FromShared(std::shared_ptr<Object> object) {
+        return ObjectHolder(std::move(object));
+    }
+
     ObjectHolder ObjectHolder::None() {
         return ObjectHolder();
     }
@@ -53,18 +67,89 @@ namespace runtime {
         if (const auto* obj = object.TryAs<Number>()) {
             if (obj->GetValue() != 0) { return true; }
         }
+        if (const auto* obj = object.TryAs<BigNumber>()) {
+            if (!obj->GetValue().IsZero()) { return true; }
+        }
+        if (const auto* obj = object.TryAs<Float>()) {
+            if (obj->GetValue() != 0.0) { return true; }
+        }
+        if (const auto* obj = object.TryAs<List>()) {
+            if (obj->GetSize() != 0) { return true; }
+        }
+        if (const auto* obj = object.TryAs<Dict>()) {
+            if (obj->GetSize() != 0) { return true; }
+        }
         return false;
     }
+
+    string_view FormatFloat(double value, FloatDigits& digits) {
+        //      ".0"
+        const auto result = to_chars(digits.data(), digits.data() + digits.size() - 3, value);
+        char* end = result.ptr;
+        const string_view text(digits.data(), end - digits.data());
+        if (text.find_first_of(".eni"sv) == string_view::npos) {
+            *end++ = '.';
+            *end++ = '0';
+        }
+        return { digits.data(), static_cast<size_t>(end - digits.data()) };
+    }
+
+    bool TryGetFloat(const ObjectHolder& object, double* value) {
+        if (const auto* num = object.TryAs<Float>()) {
+            *value = num->GetValue();
+            return true;
+        }
+        if (const auto* num = object.TryAs<Number>()) {
+            *value = static_cast<double>(num->GetValue());
+            return true;
+        }
+        if (const auto* num = object.TryAs<BigNumber>()) {
+            *value = num->GetValue().ToDouble();
+            return true;
+        }
+        return false;
+    }
+
+    bool TryGetInteger(const ObjectHolder& object, BigInteger* value) {
+        if (const auto* num = object.TryAs<Number>()) {
+            *value = BigInteger(num->GetValue());
+            return true;
+        }
+        if (const auto* num = object.TryAs<BigNumber>()) {
+            *value = num->GetValue();
+            return true;
+        }
+        return false;
+    }
+
+    ObjectHolder MakeInteger(BigInteger value) {
+        if (value.FitsInt64()) {
+            return ObjectHolder::Own(Number(value.ToInt64()));
+        }
+        return ObjectHolder::Own(BigNumber(std::move(value)));
+    }
     /*
  *      __str__,   os ,   .
  *     os   .
  */
     void ClassInstance::Print(std::ostream& os, Context& context) {
-        if (HasMethod("__str__", 0)) {
-            cls_.GetMethod("__str__")->body.get()->Execute(closure_, context).Get()->Print(os, context);
+        if (HasMethod(STR_METHOD, 0)) {
+            Call(STR_METHOD, {}, context).Get()->Print(os, context);
+        }
+        else {
+            os << this;
+        }
+    }
+
+    void ClassInstance::Render(std::string& out, Context& context) {
+        if (HasMethod(STR_METHOD, 0)) {
+            Call(STR_METHOD, {}, context).Get()->Render(out, context);
         }
         else {
+            //    ,    ostream,     
+            ostringstream os;
             os << this;
+            out += os.str();
         }
     }
     //  true,     method,  argument_count 
@@ -78,38 +163,347 @@ namespace runtime {
         }
         return false;
     }
-    //    Closure,   
+    namespace {
+        constexpr int32_t EMPTY_SLOT = -1;
+    }  // namespace
+
+    static_assert(std::is_nothrow_move_constructible_v<FieldMap::value_type>
+        && std::is_nothrow_move_assignable_v<FieldMap::value_type>);
+
+    FieldMap::FieldMap(const FieldMap& other) {
+        try {
+            for (const auto& [name, value] : other) {
+                Append(name)->second = value;
+            }
+        }
+        catch (...) {
+            Destroy();
+            throw;
+        }
+    }
+
+    FieldMap::FieldMap(FieldMap&& other) noexcept {
+        MoveFrom(other);
+    }
+
+    FieldMap& FieldMap::operator=(FieldMap other) noexcept {
+        swap(other);
+        return *this;
+    }
 
-    Closure& ClassInstance::Fields() {
-        return closure_;
+    FieldMap::~FieldMap() {
+        Destroy();
     }
-    //     Closure,   
 
-    const Closure& ClassInstance::Fields() const {
-        return closure_;
+    FieldMap::iterator FieldMap::find(const std::string& name) {
+        return data_ + FindPosition(name);
+    }
+
+    FieldMap::const_iterator FieldMap::find(const std::string& name) const {
+        return data_ + FindPosition(name);
+    }
+
+    size_t FieldMap::count(const std::string& name) const {
+        return FindPosition(name) != size_ ? 1 : 0;
+    }
+
+    ObjectHolder& FieldMap::at(const std::string& name) {
+        const size_t position = FindPosition(name);
+        if (position == size_) {
+            throw out_of_range("No field "s + name);
+        }
+        return data_[position].second;
+    }
+
+    const ObjectHolder& FieldMap::at(const std::string& name) const {
+        return const_cast<FieldMap&>(*this).at(name);
+    }
+
+    ObjectHolder& FieldMap::operator[](const std::string& name) {
+        return try_emplace(name).first->second;
+    }
+
+    std::pair<FieldMap::iterator, bool> FieldMap::try_emplace(const std::string& name) {
+        const size_t position = FindPosition(name);
+        if (position != size_) {
+            return { data_ + position, false };
+        }
+        return { Append(name), true };
+    }
+
+    std::pair<FieldMap::iterator, bool> FieldMap::emplace(const std::string& name, ObjectHolder value) {
+        auto result = try_emplace(name);
+        if (result.second) {
+            result.first->second = std::move(value);
+        }
+        return result;
+    }
+
+    void FieldMap::erase(iterator position) noexcept {
+        //   ,    
+        std::move(position + 1, end(), position);
+        --size_;
+        data_[size_].~value_type();
+        if (index_ != nullptr) {
+            std::fill_n(index_.get(), index_mask_ + 1, EMPTY_SLOT);
+            for (size_t i = 0; i < size_; ++i) {
+                IndexEntry(i);
+            }
+        }
+    }
+
+    void FieldMap::swap(FieldMap& other) noexcept {
+        FieldMap temp(std::move(other));
+        other.MoveFrom(*this);
+        MoveFrom(temp);
+    }
+
+    size_t FieldMap::GetStorageBytes() const {
+        size_t bytes = IsInline() ? 0 : capacity_ * sizeof(value_type);
+        if (index_ != nullptr) {
+            bytes += (index_mask_ + 1) * sizeof(int32_t);
+        }
+        return bytes;
+    }
+
+    size_t FieldMap::GetHeapBytes() const {
+        size_t bytes = GetStorageBytes();
+        for (const auto& [name, value] : *this) {
+            bytes += GetStringHeapBytes(name);
+        }
+        return bytes;
+    }
+
+    size_t FieldMap::FindPosition(const std::string& name) const {
+        if (index_ == nullptr) {
+            for (size_t i = 0; i < size_; ++i) {
+                if (data_[i].first == name) {
+                    return i;
+                }
+            }
+            return size_;
+        }
+        for (size_t slot = hash<string>{}(name) & index_mask_;; slot = (slot + 1) & index_mask_) {
+            const int32_t position = index_[slot];
+            if (position == EMPTY_SLOT) {
+                return size_;
+            }
+            if (data_[position].first == name) {
+                return static_cast<size_t>(position);
+            }
+        }
+    }
+
+    FieldMap::iterator FieldMap::Append(const std::string& name) {
+        if (size_ == capacity_) {
+            Grow();
+        }
+        new (data_ + size_) value_type(piecewise_construct, forward_as_tuple(name), forward_as_tuple());
+        ++size_;
+        try {
+            if (index_ != nullptr) {
+                //      ,     
+                if (size_ * 2 > index_mask_ + 1) {
+                    RebuildIndex((index_mask_ + 1) * 2);
+                }
+                else {
+                    IndexEntry(size_ - 1);
+                }
+            }
+            else if (size_ > LINEAR_SEARCH_LIMIT) {
+                RebuildIndex(LINEAR_SEARCH_LIMIT * 4);
+            }
+        }
+        catch (...) {
+            --size_;
+            data_[size_].~value_type();
+            throw;
+        }
+        return data_ + size_ - 1;
+    }
+
+    void FieldMap::Grow() {
+        const uint32_t capacity = capacity_ * 2;
+        auto* data = static_cast<value_type*>(::operator new(capacity * sizeof(value_type)));
+        for (size_t i = 0; i < size_; ++i) {
+            new (data + i) value_type(std::move(data_[i]));
+            data_[i].~value_type();
+        }
+        if (!IsInline()) {
+            ::operator delete(data_);
+        }
+        data_ = data;
+        capacity_ = capacity;
+    }
+
+    void FieldMap::RebuildIndex(size_t slot_count) {
+        auto index = make_unique<int32_t[]>(slot_count);
+        std::fill_n(index.get(), slot_count, EMPTY_SLOT);
+        index_ = std::move(index);
+        index_mask_ = slot_count - 1;
+        for (size_t i = 0; i < size_; ++i) {
+            IndexEntry(i);
+        }
+    }
+
+    void FieldMap::IndexEntry(size_t position) noexcept {
+        size_t slot = hash<string>{}(data_[position].first) & index_mask_;
+        while (index_[slot] != EMPTY_SLOT) {
+            slot = (slot + 1) & index_mask_;
+        }
+        index_[slot] = static_cast<int32_t>(position);
+    }
+
+    void FieldMap::MoveFrom(FieldMap& other) noexcept {
+        if (other.IsInline()) {
+            for (size_t i = 0; i < other.size_; ++i) {
+                new (data_ + i) value_type(std::move(other.data_[i]));
+                other.data_[i].~value_type();
+            }
+        }
+        else {
+            data_ = other.data_;
+        }
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        index_ = std::move(other.index_);
+        index_mask_ = other.index_mask_;
+
+        other.data_ = reinterpret_cast<value_type*>(other.inline_);
+        other.size_ = 0;
+        other.capacity_ = INLINE_CAPACITY;
+        other.index_mask_ = 0;
+    }
+
+    void FieldMap::Destroy() noexcept {
+        for (size_t i = 0; i < size_; ++i) {
+            data_[i].~value_type();
+        }
+        if (!IsInline()) {
+            ::operator delete(data_);
+            data_ = reinterpret_cast<value_type*>(inline_);
+        }
+        size_ = 0;
+        capacity_ = INLINE_CAPACITY;
+        index_.reset();
+        index_mask_ = 0;
+    }
+
+    FieldMap& ClassInstance::Fields() {
+        return fields_;
+    }
+
+    const FieldMap& ClassInstance::Fields() const {
+        return fields_;
     }
 
     ClassInstance::ClassInstance(const Class& cls) : cls_(cls) {
     }
+
+    ObjectHolder ClassInstance::GetSelf() {
+        //    :       .
+        // ,    shared_ptr (,  ),   
+        if (auto self = weak_from_this().lock()) {
+            return ObjectHolder::FromShared(std::move(self));
+        }
+        return ObjectHolder::Share(*this);
+    }
+
+    ObjectHolder& ClassInstance::SetField(const std::string& name, ObjectHolder value) {
+        const size_t storage_bytes = fields_.GetStorageBytes();
+        auto [it, inserted] = fields_.try_emplace(name);
+        if (inserted) {
+            try {
+                //      ,    
+                fields_charge_.Add(fields_.GetStorageBytes() - storage_bytes + GetStringHeapBytes(it->first));
+            }
+            catch (...) {
+                fields_.erase(it);
+                throw;
+            }
+        }
+        return it->second = std::move(value);
+    }
+
+    const Class& ClassInstance::GetClass() const {
+        return cls_;
+    }
     /*
  *     method,   actual_args .
  *  context     .
  *    ,       method,   
  * runtime_error
  */
+    ObjectHolder& AssignVariable(Closure& closure, const std::string& name, ObjectHolder value) {
+        auto it = closure.find(name);
+        if (it == closure.end()) {
+            it = FrameStack::ForThread().Insert(closure, name);
+            if (auto* account = MemoryAccount::Current()) {
+                try {
+                    account->Allocate(MemoryKind::Closure, GetClosureEntryBytes(name));
+                }
+                catch (...) {
+                    closure.erase(it);
+                    throw;
+                }
+            }
+        }
+        return it->second = std::move(value);
+    }
+
+    namespace {
+
+        size_t GetClosureBytes(const Closure& closure) {
+            size_t bytes = 0;
+            for (const auto& [name, value] : closure) {
+                bytes += GetClosureEntryBytes(name);
+            }
+            return bytes;
+        }
+
+    }  // namespace
+
+    ClosureCharge::ClosureCharge(const Closure& closure)
+        : closure_(closure)
+        , account_(MemoryAccount::Current()) {
+        if (account_ != nullptr) {
+            initial_bytes_ = GetClosureBytes(closure_);
+        }
+    }
+
+    ClosureCharge::~ClosureCharge() {
+        if (account_ != nullptr) {
+            account_->Release(MemoryKind::Closure, GetClosureBytes(closure_) - initial_bytes_);
+        }
+    }
+
     ObjectHolder ClassInstance::Call(const std::string& method,
         const std::vector<ObjectHolder>& actual_args,
         Context& context) {
-        Closure closure;
+        FrameStack::ArgumentFrame args(FrameStack::ForThread());
+        for (const auto& arg : actual_args) {
+            args.Push(arg);
+        }
+        return Call(method, args.Get(), context);
+    }
 
-        if (HasMethod(method, actual_args.size())) {
-            closure["self"] = ObjectHolder::Share(*this);
-            for (size_t i = 0; i < actual_args.size(); i++) {
-                closure[cls_.GetMethod(method)->formal_params[i]] = actual_args[i];
-            }
-            return cls_.GetMethod(method)->body->Execute(closure, context);
+    ObjectHolder ClassInstance::Call(const std::string& method, Arguments args, Context& context) {
+        static const std::string SELF = "self"s;
+
+        context.ChargeFuel();
+        const Method* found = cls_.GetMethod(method);
+        if (found == nullptr || found->formal_params.size() != args.size) {
+            throw runtime_error("");
         }
-        throw runtime_error("");
+        FrameStack::LocalFrame frame(FrameStack::ForThread());
+        Closure& closure = frame.GetClosure();
+        const ClosureCharge frame_charge(closure);
+
+        AssignVariable(closure, SELF, GetSelf());
+        for (size_t i = 0; i < args.size; ++i) {
+            AssignVariable(closure, found->formal_params[i], std::move(args.data[i]));
+        }
+        return found->body->Execute(closure, context);
     }
 
     Class::Class(std::string name, std::vector<Method> methods, const Class* parent) : name_(name), methods_(std::move(methods)), parent_(parent) {
@@ -132,15 +526,291 @@ namespace runtime {
         return name_;
     }
 
+    SlabPool& Class::GetInstancePool() const {
+        return *instance_pool_;
+    }
+
+    SlabStats Class::GetInstanceStats() const {
+        return instance_pool_->GetStats();
+    }
+
     //   os  "Class < >",  "Class cat"
     void Class::Print(ostream& os, Context& context) {
         os << "Class " << name_;
     }
 
+    void Class::Render(std::string& out, [[maybe_unused]] Context& context) {
+        out += "Class "sv;
+        out += name_;
+    }
+
     void Bool::Print(std::ostream& os, [[maybe_unused]] Context& context) {
         os << (GetValue() ? "True"sv : "False"sv);
     }
 
+    void Bool::Render(std::string& out, [[maybe_unused]] Context& context) {
+        out += GetValue() ? "True"sv : "False"sv;
+    }
+
+    void Object::Render(std::string& out, Context& context) {
+        ostringstream os;
+        Print(os, context);
+        out += os.str();
+    }
+
+    void PrintItem(std::ostream& os, const ObjectHolder& item, Context& context) {
+        if (!item) {
+            os << "None"sv;
+        } else if (const auto* str = item.TryAs<String>()) {
+            os << '\'' << str->GetValue() << '\'';
+        } else {
+            item->Print(os, context);
+        }
+    }
+
+    void List::Print(std::ostream& os, Context& context) {
+        // ,      : ,   ,   [...]
+        thread_local vector<const List*> printing;
+        if (find(printing.begin(), printing.end(), this) != printing.end()) {
+            os << "[...]"sv;
+            return;
+        }
+        os << '[';
+        if (!boxed_) {
+            for (size_t i = 0; i < integers_.size(); ++i) {
+                os << (i == 0 ? ""sv : ", "sv) << integers_[i];
+            }
+        } else {
+            printing.push_back(this);
+            try {
+                for (size_t i = 0; i < objects_.size(); ++i) {
+                    os << (i == 0 ? ""sv : ", "sv);
+                    PrintItem(os, objects_[i], context);
+                }
+            } catch (...) {
+                printing.pop_back();
+                throw;
+            }
+            printing.pop_back();
+        }
+        os << ']';
+    }
+
+    List::List(const List& other)
+        : Object(other)
+        , integers_(other.integers_)
+        , objects_(other.objects_)
+        , boxed_(other.boxed_) {
+        ChargeStorage(GetHeapBytes());
+    }
+
+    size_t List::GetSize() const {
+        return boxed_ ? objects_.size() : integers_.size();
+    }
+
+    size_t List::GetPosition(int64_t index) const {
+        const auto size = static_cast<int64_t>(GetSize());
+        if (index < 0) {
+            index += size;
+        }
+        if (index < 0 || index >= size) {
+            throw runtime_error("List index out of range"s);
+        }
+        return static_cast<size_t>(index);
+    }
+
+    ObjectHolder List::GetItem(int64_t index) const {
+        const size_t position = GetPosition(index);
+        return boxed_ ? objects_[position] : ObjectHolder::Own(Number(integers_[position]));
+    }
+
+    void List::SetItem(int64_t index, ObjectHolder value) {
+        const size_t position = GetPosition(index);
+        if (!boxed_) {
+            if (const auto* num = value.TryAs<Number>()) {
+                integers_[position] = num->GetValue();
+                return;
+            }
+            Box();
+        }
+        objects_[position] = std::move(value);
+    }
+
+    void List::Append(ObjectHolder value) {
+        if (!boxed_) {
+            if (const auto* num = value.TryAs<Number>()) {
+                Reserve(integers_);
+                integers_.push_back(num->GetValue());
+                return;
+            }
+            Box();
+        }
+        Reserve(objects_);
+        objects_.push_back(std::move(value));
+    }
+
+    void List::Clear() {
+        vector<ObjectHolder> objects;
+        objects.swap(objects_);
+        integers_.clear();
+        boxed_ = false;
+    }
+
+    template <typename T>
+    void List::Reserve(vector<T>& items) {
+        if (items.size() < items.capacity()) {
+            return;
+        }
+        const size_t capacity = max<size_t>(4, items.capacity() * 2);
+        ChargeStorage(GetHeapBytes() + (capacity - items.capacity()) * sizeof(T));
+        items.reserve(capacity);
+    }
+
+    void List::ChargeStorage(size_t bytes) {
+        if (bytes > charged_bytes_) {
+            storage_charge_.Add(bytes - charged_bytes_);
+            charged_bytes_ = bytes;
+        }
+    }
+
+    void List::Box() {
+        //   ,    
+        ChargeStorage(GetHeapBytes() + integers_.size() * sizeof(ObjectHolder));
+        vector<ObjectHolder> objects;
+        objects.reserve(integers_.size());
+        for (const int64_t value : integers_) {
+            objects.push_back(ObjectHolder::Own(Number(value)));
+        }
+        objects_.swap(objects);
+        vector<int64_t>().swap(integers_);
+        boxed_ = true;
+    }
+
+    ObjectHolder List::SumIntegers() const {
+        assert(!boxed_);
+        const size_t size = integers_.size();
+        if (size == 0) {
+            return ObjectHolder::Own(Number(0));
+        }
+        //     2^64    ,   .
+        //   range -   x ^ (x << 1).   range    
+        // width  ,      width - 1  63   ,  
+        // |x| <= 2^(width - 1).   size * 2^(width - 1) <= MAX   
+        //  int64_t      
+        uint64_t wrapped_sum = 0;
+        uint64_t range = 0;
+        for (const int64_t value : integers_) {
+            const auto bits = static_cast<uint64_t>(value);
+            wrapped_sum += bits;
+            range |= bits ^ (bits << 1);
+        }
+        int width = 0;
+        while (width < 64 && (range >> width) != 0) {
+            ++width;
+        }
+        const uint64_t bound = width == 0 ? 0 : uint64_t{ 1 } << (width - 1);
+        if (bound <= static_cast<uint64_t>(numeric_limits<int64_t>::max()) / size) {
+            return ObjectHolder::Own(Number(static_cast<int64_t>(wrapped_sum)));
+        }
+
+        int64_t sum = 0;
+        size_t i = 0;
+        for (int64_t next = 0; i < size && CheckedAdd(sum, integers_[i], &next); ++i) {
+            sum = next;
+        }
+        BigInteger total(sum);
+        for (; i < size; ++i) {
+            total = total + BigInteger(integers_[i]);
+        }
+        return MakeInteger(std::move(total));
+    }
+
+    ObjectHolder List::Min(Context& context) const {
+        if (GetSize() == 0) {
+            throw runtime_error("min() of an empty list"s);
+        }
+        if (!boxed_) {
+            int64_t lowest = integers_[0];
+            for (const int64_t value : integers_) {
+                lowest = min(lowest, value);
+            }
+            return ObjectHolder::Own(Number(lowest));
+        }
+        ObjectHolder lowest = objects_[0];
+        for (size_t i = 1; i < objects_.size(); ++i) {
+            if (Less(objects_[i], lowest, context)) {
+                lowest = objects_[i];
+            }
+        }
+        return lowest;
+    }
+
+    ObjectHolder List::Max(Context& context) const {
+        if (GetSize() == 0) {
+            throw runtime_error("max() of an empty list"s);
+        }
+        if (!boxed_) {
+            int64_t highest = integers_[0];
+            for (const int64_t value : integers_) {
+                highest = max(highest, value);
+            }
+            return ObjectHolder::Own(Number(highest));
+        }
+        ObjectHolder highest = objects_[0];
+        for (size_t i = 1; i < objects_.size(); ++i) {
+            if (Less(highest, objects_[i], context)) {
+                highest = objects_[i];
+            }
+        }
+        return highest;
+    }
+
+    void List::Sort(Context& context) {
+        if (!boxed_) {
+            sort(integers_.begin(), integers_.end());
+            return;
+        }
+        //      ,   
+        vector<ObjectHolder> sorted = objects_;
+        stable_sort(sorted.begin(), sorted.end(), [&context](const ObjectHolder& lhs, const ObjectHolder& rhs) {
+            return Less(lhs, rhs, context);
+        });
+        objects_.swap(sorted);
+    }
+
+    ObjectHolder List::Call(const std::string& method, Arguments args, Context& context) {
+        context.ChargeFuel();
+        if (method == "append"sv && args.size == 1) {
+            Append(std::move(args.data[0]));
+            return ObjectHolder::None();
+        }
+        if (method == "sort"sv && args.size == 0) {
+            Sort(context);
+            return ObjectHolder::None();
+        }
+        throw runtime_error("");
+    }
+
+    void ExecutionBudget::SetSlice(uint64_t amount) {
+        slice_limit_ = amount > UNLIMITED - used_ ? UNLIMITED : used_ + amount;
+        preemption_requested_ = false;
+        next_check_ = min(slice_limit_, hard_limit_);
+    }
+
+    void ExecutionBudget::OnLimitReached() {
+        if (used_ > hard_limit_) {
+            throw FuelExhausted();
+        }
+        if (used_ > slice_limit_) {
+            preemption_requested_ = true;
+            next_check_ = hard_limit_;
+        }
+    }
+
+    void Context::Write(string_view text) {
+        GetOutputStream().write(text.data(), static_cast<streamsize>(text.size()));
+    }
+
     bool Equal(const ObjectHolder& lhs, const ObjectHolder& rhs, Context& context) {
         // .   
         if (lhs.TryAs<Bool>() && rhs.TryAs<Bool>()) {
@@ -152,9 +822,61 @@ namespace runtime {
         if (lhs.TryAs<Number>() && rhs.TryAs<Number>()) {
             return lhs.TryAs<Number>()->GetValue() == rhs.TryAs<Number>()->GetValue();
         }
+        //   Float   double
+        if (lhs.TryAs<Float>() != nullptr || rhs.TryAs<Float>() != nullptr) {
+            if (double l, r; TryGetFloat(lhs, &l) && TryGetFloat(rhs, &r)) {
+                return l == r;
+            }
+        }
+        //      Number,      
+        if (BigInteger l, r; TryGetInteger(lhs, &l) && TryGetInteger(rhs, &r)) {
+            return l == r;
+        }
+        if (const auto* l = lhs.TryAs<List>()) {
+            if (const auto* r = rhs.TryAs<List>()) {
+                if (l == r) {
+                    return true;
+                }
+                if (l->HoldsIntegers() && r->HoldsIntegers()) {
+                    return l->GetIntegers() == r->GetIntegers();
+                }
+                if (l->GetSize() != r->GetSize()) {
+                    return false;
+                }
+                for (size_t i = 0; i < l->GetSize(); ++i) {
+                    const auto index = static_cast<int64_t>(i);
+                    if (!Equal(l->GetItem(index), r->GetItem(index), context)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
+        //  ,           ,   
+        if (const auto* l = lhs.TryAs<Dict>()) {
+            if (auto* r = rhs.TryAs<Dict>()) {
+                if (l == r) {
+                    return true;
+                }
+                if (l->GetSize() != r->GetSize()) {
+                    return false;
+                }
+                for (const auto& entry : l->GetEntries()) {
+                    if (entry.erased) {
+                        continue;
+                    }
+                    const ObjectHolder* value = r->Find(entry.key, context);
+                    if (value == nullptr || !Equal(entry.value, *value, context)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        }
         if (lhs.TryAs<ClassInstance>()) {
             if (lhs.TryAs<ClassInstance>()->HasMethod("__eq__", 1)) {
-                return IsTrue(lhs.TryAs<ClassInstance>()->Call("__eq__"s, { rhs }, context));
+                ObjectHolder arg = rhs;
+                return IsTrue(lhs.TryAs<ClassInstance>()->Call("__eq__"s, Arguments{ &arg, 1 }, context));
             }
         }
         if (lhs.Get() == nullptr && rhs.Get() == nullptr) {
@@ -174,9 +896,18 @@ namespace runtime {
         if (lhs.TryAs<Number>() && rhs.TryAs<Number>()) {
             return lhs.TryAs<Number>()->GetValue() < rhs.TryAs<Number>()->GetValue();
         }
+        if (lhs.TryAs<Float>() != nullptr || rhs.TryAs<Float>() != nullptr) {
+            if (double l, r; TryGetFloat(lhs, &l) && TryGetFloat(rhs, &r)) {
+                return l < r;
+            }
+        }
+        if (BigInteger l, r; TryGetInteger(lhs, &l) && TryGetInteger(rhs, &r)) {
+            return l < r;
+        }
         if (lhs.TryAs<ClassInstance>()) {
             if (lhs.TryAs<ClassInstance>()->HasMethod("__lt__", 1)) {
-                return IsTrue(lhs.TryAs<ClassInstance>()->Call("__lt__"s, { rhs }, context));
+                ObjectHolder arg = rhs;
+                return IsTrue(lhs.TryAs<ClassInstance>()->Call("__lt__"s, Arguments{ &arg, 1 }, context));
             }
         }
         throw runtime_error("");
@@ -1,21 +1,121 @@
 #pragma once
 
+#include "big_integer.h"
+#include "memory_account.h"
+#include "slab_pool.h"
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <exception>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace runtime {
 
+    class CycleCollector;
+
+    // ,      .
+    //    runtime_error:    ,    
+    class FuelExhausted : public std::exception {
+    public:
+        [[nodiscard]] const char* what() const noexcept override {
+            return "Execution fuel exhausted";
+        }
+    };
+
+    //    .     ,  
+    //     ,         .
+    //       FuelExhausted.  (SetSlice)
+    //   :     ,  IsPreemptionRequested()
+    //  ,        
+    class ExecutionBudget {
+    public:
+        static constexpr uint64_t UNLIMITED = std::numeric_limits<uint64_t>::max();
+
+        explicit ExecutionBudget(uint64_t hard_limit = UNLIMITED)
+            : hard_limit_(hard_limit)
+            , next_check_(hard_limit) {
+        }
+
+        void Charge(uint64_t cost) {
+            used_ += cost;
+            //        
+            if (used_ > next_check_) {
+                OnLimitReached();
+            }
+        }
+
+        //    amount     
+        void SetSlice(uint64_t amount);
+
+        [[nodiscard]] bool IsPreemptionRequested() const {
+            return preemption_requested_;
+        }
+
+        [[nodiscard]] uint64_t GetUsed() const {
+            return used_;
+        }
+
+    private:
+        void OnLimitReached();
+
+        uint64_t used_ = 0;
+        uint64_t hard_limit_;
+        uint64_t slice_limit_ = UNLIMITED;
+        uint64_t next_check_;
+        bool preemption_requested_ = false;
+    };
+
     //    Mython
     class Context {
     public:
         //      print
         virtual std::ostream& GetOutputStream() = 0;
 
+        //       print.     
+        //  GetOutputStream()   write;     
+        //     
+        virtual void Write(std::string_view text);
+
+        //        . nullptr -  
+        void SetBudget(ExecutionBudget* budget) {
+            budget_ = budget;
+        }
+
+        [[nodiscard]] ExecutionBudget* GetBudget() const {
+            return budget_;
+        }
+
+        //   ,     . nullptr -  
+        void SetCycleCollector(CycleCollector* collector) {
+            collector_ = collector;
+        }
+
+        [[nodiscard]] CycleCollector* GetCycleCollector() const {
+            return collector_;
+        }
+
+        //  cost  ,   
+        void ChargeFuel(uint64_t cost = 1) {
+            if (budget_ != nullptr) {
+                budget_->Charge(cost);
+            }
+        }
+
     protected:
         ~Context() = default;
+
+    private:
+        ExecutionBudget* budget_ = nullptr;
+        CycleCollector* collector_ = nullptr;
     };
 
 
@@ -27,6 +127,27 @@ namespace runtime {
         virtual ~Object() = default;
         //   os     
         virtual void Print(std::ostream& os, Context& context) = 0;
+        //    out   ,    .
+        //       Print   
+        virtual void Render(std::string& out, Context& context);
+    };
+
+    //     T   (. SlabPool).   ENABLED = true
+    //  GetPool(const T&)
+    template <typename T>
+    struct SlabTraits {
+        static constexpr bool ENABLED = false;
+    };
+
+    //      T (. MemoryAccount)
+    template <typename T>
+    struct MemoryTraits {
+        static constexpr MemoryKind KIND = MemoryKind::Other;
+
+        // ,      
+        static size_t GetExtraBytes(const T&) {
+            return 0;
+        }
     };
 
 
@@ -43,11 +164,23 @@ namespace runtime {
         // object     
         template <typename T>
         [[nodiscard]] static ObjectHolder Own(T&& object) {
+            if constexpr (SlabTraits<T>::ENABLED) {
+                const auto* account = MemoryAccount::CurrentOwner();
+                SlabAllocator<T> allocator(SlabTraits<T>::GetPool(object), account != nullptr ? *account : nullptr,
+                    MemoryTraits<T>::KIND, MemoryTraits<T>::GetExtraBytes(object));
+                return ObjectHolder(std::allocate_shared<T>(allocator, std::forward<T>(object)));
+            }
+            if (const auto* account = MemoryAccount::CurrentOwner()) {
+                AccountingAllocator<T> allocator(*account, MemoryTraits<T>::KIND, MemoryTraits<T>::GetExtraBytes(object));
+                return ObjectHolder(std::allocate_shared<T>(allocator, std::forward<T>(object)));
+            }
             return ObjectHolder(std::make_shared<T>(std::forward<T>(object)));
         }
 
         //  ObjectHolder,    (  )
         [[nodiscard]] static ObjectHolder Share(Object& object);
+        //  ObjectHolder,     object
+        [[nodiscard]] static ObjectHolder FromShared(std::shared_ptr<Object> object);
         //   ObjectHolder,   None
         [[nodiscard]] static ObjectHolder None();
 
@@ -69,6 +202,17 @@ namespace runtime {
         //  true,  ObjectHolder  
         explicit operator bool() const;
 
+        //  true,      .   (Share)  
+        [[nodiscard]] bool IsUnique() const {
+            return data_.use_count() == 1;
+        }
+
+        //    .  ObjectHolder,   Share,  
+        //          
+        [[nodiscard]] std::weak_ptr<Object> GetWeakPtr() const {
+            return data_;
+        }
+
     private:
         explicit ObjectHolder(std::shared_ptr<Object> data);
         void AssertIsValid() const;
@@ -79,22 +223,61 @@ namespace runtime {
 
 
 
+    // ,     double   FormatFloat
+    using FloatDigits = std::array<char, 32>;
+
+    //   value,       .   
+    //  ".0",   Python: 2.0,   2
+    std::string_view FormatFloat(double value, FloatDigits& digits);
+
+
+
     // -,    T
     template <typename T>
     class ValueObject : public Object {
     public:
         ValueObject(T v)  // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
-            : value_(v) {
+            : value_(std::move(v)) {
         }
 
         void Print(std::ostream& os, [[maybe_unused]] Context& context) override {
-            os << value_;
+            if constexpr (std::is_floating_point_v<T>) {
+                FloatDigits digits;
+                os << FormatFloat(value_, digits);
+            }
+            else {
+                os << value_;
+            }
+        }
+
+        void Render(std::string& out, Context& context) override {
+            if constexpr (std::is_same_v<T, std::string>) {
+                out += value_;
+            }
+            else if constexpr (std::is_floating_point_v<T>) {
+                FloatDigits digits;
+                out += FormatFloat(value_, digits);
+            }
+            else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+                char digits[24];
+                const auto result = std::to_chars(digits, digits + sizeof(digits), value_);
+                out.append(digits, result.ptr);
+            }
+            else {
+                Object::Render(out, context);
+            }
         }
 
         [[nodiscard]] const T& GetValue() const {
             return value_;
         }
 
+        //  .    ,     ,
+        //      (. ObjectHolder::IsUnique)
+        void SetValue(T value) {
+            value_ = std::move(value);
+        }
+
     private:
         T value_;
     };
@@ -104,12 +287,148 @@ namespace runtime {
     //  ,      
     using Closure = std::unordered_map<std::string, ObjectHolder>;
 
+    //       
+    inline constexpr size_t SHORT_STRING_CAPACITY = 15;
+
+    [[nodiscard]] inline size_t GetStringHeapBytes(const std::string& str) {
+        return str.capacity() > SHORT_STRING_CAPACITY ? str.capacity() + 1 : 0;
+    }
+
+    //     Closure:  -     ,  
+    [[nodiscard]] inline size_t GetClosureEntryBytes(const std::string& name) {
+        return sizeof(Closure::value_type) + 2 * sizeof(void*) + GetStringHeapBytes(name);
+    }
+
+    //    name.       ;
+    //      
+    ObjectHolder& AssignVariable(Closure& closure, const std::string& name, ObjectHolder value);
+
+    //        ,   closure
+    //  AssignVariable    .   Closure  ,   
+    //     .   closure,     
+    class ClosureCharge {
+    public:
+        explicit ClosureCharge(const Closure& closure);
+        ~ClosureCharge();
+
+        ClosureCharge(const ClosureCharge&) = delete;
+        ClosureCharge& operator=(const ClosureCharge&) = delete;
+
+    private:
+        const Closure& closure_;
+        MemoryAccount* account_;
+        size_t initial_bytes_ = 0;
+    };
+
+    //   ,    .     .
+    //    ,  Call(method, {}, context) -  
+    struct Arguments {
+        Arguments(ObjectHolder* data, size_t size)
+            : data(data)
+            , size(size) {
+        }
+
+        ObjectHolder* data;
+        size_t size;
+    };
+
+    //   .      ,  INLINE_CAPACITY -
+    //   .     LINEAR_SEARCH_LIMIT,   ,
+    //     -   .
+    //  ,    vector,       
+    class FieldMap {
+    public:
+        using value_type = std::pair<std::string, ObjectHolder>;
+        using iterator = value_type*;
+        using const_iterator = const value_type*;
+
+        static constexpr size_t INLINE_CAPACITY = 4;
+        static constexpr size_t LINEAR_SEARCH_LIMIT = 8;
+
+        FieldMap() = default;
+        FieldMap(const FieldMap& other);
+        FieldMap(FieldMap&& other) noexcept;
+        FieldMap& operator=(FieldMap other) noexcept;
+        ~FieldMap();
+
+        [[nodiscard]] iterator begin() {
+            return data_;
+        }
+        [[nodiscard]] iterator end() {
+            return data_ + size_;
+        }
+        [[nodiscard]] const_iterator begin() const {
+            return data_;
+        }
+        [[nodiscard]] const_iterator end() const {
+            return data_ + size_;
+        }
+
+        [[nodiscard]] size_t size() const {
+            return size_;
+        }
+        [[nodiscard]] bool empty() const {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] iterator find(const std::string& name);
+        [[nodiscard]] const_iterator find(const std::string& name) const;
+        [[nodiscard]] size_t count(const std::string& name) const;
+
+        //  std::out_of_range,   
+        [[nodiscard]] ObjectHolder& at(const std::string& name);
+        [[nodiscard]] const ObjectHolder& at(const std::string& name) const;
+
+        ObjectHolder& operator[](const std::string& name);
+        std::pair<iterator, bool> try_emplace(const std::string& name);
+        std::pair<iterator, bool> emplace(const std::string& name, ObjectHolder value);
+        void erase(iterator position) noexcept;
+
+        void swap(FieldMap& other) noexcept;
+
+        // ,    :      
+        [[nodiscard]] size_t GetStorageBytes() const;
+        //       
+        [[nodiscard]] size_t GetHeapBytes() const;
+
+    private:
+        [[nodiscard]] size_t FindPosition(const std::string& name) const;
+        iterator Append(const std::string& name);
+        void Grow();
+        void RebuildIndex(size_t slot_count);
+        void IndexEntry(size_t position) noexcept;
+        //   other;  FieldMap   
+        void MoveFrom(FieldMap& other) noexcept;
+        void Destroy() noexcept;
+        [[nodiscard]] bool IsInline() const {
+            return data_ == reinterpret_cast<const value_type*>(inline_);
+        }
+
+        alignas(value_type) unsigned char inline_[INLINE_CAPACITY * sizeof(value_type)];
+        value_type* data_ = reinterpret_cast<value_type*>(inline_);
+        uint32_t size_ = 0;
+        uint32_t capacity_ = INLINE_CAPACITY;
+        //       nullptr,   
+        std::unique_ptr<int32_t[]> index_;
+        size_t index_mask_ = 0;
+    };
+
 
 
     // ,    object ,   True
     //     , True     true.    - false.
     bool IsTrue(const ObjectHolder& object);
 
+    //  true,   object  Number  BigNumber,     *value
+    bool TryGetInteger(const ObjectHolder& object, BigInteger* value);
+
+    //  Number,  value   64 ,  BigNumber
+    ObjectHolder MakeInteger(BigInteger value);
+
+    //  true,   object  Float, Number  BigNumber,    *value
+    //  ,   double
+    bool TryGetFloat(const ObjectHolder& object, double* value);
+
 
 
 
@@ -119,6 +438,9 @@ namespace runtime {
         virtual ~Executable() = default;
         //      closure,  context
         //     None
+        //     :      closure, context
+        //     .     
+        //  ,       
         virtual ObjectHolder Execute(Closure& closure, Context& context) = 0;
     };
 
@@ -130,7 +452,18 @@ namespace runtime {
 
 
     //  
-    using Number = ValueObject<int>;
+    using Number = ValueObject<std::int64_t>;
+
+
+
+    //    
+    using Float = ValueObject<double>;
+
+
+
+    // ,    Number.      ,
+    //  ,     64 ,   Number
+    using BigNumber = ValueObject<BigInteger>;
 
 
 
@@ -140,6 +473,52 @@ namespace runtime {
         using ValueObject<bool>::ValueObject;
 
         void Print(std::ostream& os, Context& context) override;
+        void Render(std::string& out, Context& context) override;
+    };
+
+    template <>
+    struct MemoryTraits<Number> {
+        static constexpr MemoryKind KIND = MemoryKind::Number;
+
+        static size_t GetExtraBytes(const Number&) {
+            return 0;
+        }
+    };
+
+    template <>
+    struct MemoryTraits<Float> {
+        static constexpr MemoryKind KIND = MemoryKind::Number;
+
+        static size_t GetExtraBytes(const Float&) {
+            return 0;
+        }
+    };
+
+    template <>
+    struct MemoryTraits<BigNumber> {
+        static constexpr MemoryKind KIND = MemoryKind::Number;
+
+        static size_t GetExtraBytes(const BigNumber& num) {
+            return num.GetValue().GetHeapBytes();
+        }
+    };
+
+    template <>
+    struct MemoryTraits<Bool> {
+        static constexpr MemoryKind KIND = MemoryKind::Bool;
+
+        static size_t GetExtraBytes(const Bool&) {
+            return 0;
+        }
+    };
+
+    template <>
+    struct MemoryTraits<String> {
+        static constexpr MemoryKind KIND = MemoryKind::String;
+
+        static size_t GetExtraBytes(const String& str) {
+            return GetStringHeapBytes(str.GetValue());
+        }
     };
 
 
@@ -173,25 +552,36 @@ namespace runtime {
 
         //   os  "Class < >",  "Class cat"
         void Print(std::ostream& os, Context& context) override;
+        void Render(std::string& out, Context& context) override;
+
+        // ,     
+        [[nodiscard]] SlabPool& GetInstancePool() const;
+        [[nodiscard]] SlabStats GetInstanceStats() const;
     private:
         std::string name_;
         std::vector<Method> methods_;
         const Class* parent_ = nullptr;
+        SlabPool::Owner instance_pool_ = SlabPool::Create();
     };
 
 
 
 
-    //  
-    class ClassInstance : public Object {
+    //  . ,   ObjectHolder::Own,    
+    //  ,  self     ,     
+    class ClassInstance : public Object, public std::enable_shared_from_this<ClassInstance> {
     public:
         explicit ClassInstance(const Class& cls);
 
+        //   
+        [[nodiscard]] const Class& GetClass() const;
+
         /*
          *      __str__,   os ,   .
          *     os   .
          */
         void Print(std::ostream& os, Context& context) override;
+        void Render(std::string& out, Context& context) override;
 
         /*
          *     method,   actual_args .
@@ -201,17 +591,145 @@ namespace runtime {
          */
         ObjectHolder Call(const std::string& method, const std::vector<ObjectHolder>& actual_args,
             Context& context);
+        //  ,         
+        ObjectHolder Call(const std::string& method, Arguments args, Context& context);
+
+        //    .  ,    ObjectHolder (,
+        //   ),   
+        [[nodiscard]] ObjectHolder GetSelf();
 
         //  true,     method,  argument_count 
         [[nodiscard]] bool HasMethod(const std::string& method, size_t argument_count) const;
 
-        //    Closure,   
-        [[nodiscard]] Closure& Fields();
-        //     Closure,   
-        [[nodiscard]] const Closure& Fields() const;
+        //     
+        [[nodiscard]] FieldMap& Fields();
+        //      
+        [[nodiscard]] const FieldMap& Fields() const;
+
+        //   .      , 
+        //   ;      
+        ObjectHolder& SetField(const std::string& name, ObjectHolder value);
     private:
         const Class& cls_;
-        Closure closure_;
+        FieldMap fields_;
+        MemoryCharge fields_charge_;
+    };
+
+    template <>
+    struct MemoryTraits<Class> {
+        static constexpr MemoryKind KIND = MemoryKind::Class;
+
+        static size_t GetExtraBytes(const Class&) {
+            return 0;
+        }
+    };
+
+    template <>
+    struct SlabTraits<ClassInstance> {
+        static constexpr bool ENABLED = true;
+
+        static SlabPool& GetPool(const ClassInstance& instance) {
+            return instance.GetClass().GetInstancePool();
+        }
+    };
+
+    template <>
+    struct MemoryTraits<ClassInstance> {
+        static constexpr MemoryKind KIND = MemoryKind::Instance;
+
+        static size_t GetExtraBytes(const ClassInstance&) {
+            return 0;
+        }
+    };
+
+
+
+    // .      .     Number,  
+    //   :     8   ,   
+    //    ,  ,      .
+    //           ObjectHolder.
+    //      ,    
+    class List : public Object {
+    public:
+        List() = default;
+        //             
+        List(const List& other);
+        List(List&&) = default;
+        List& operator=(const List&) = delete;
+
+        //       ,  -  : [1, 'a', None]
+        void Print(std::ostream& os, Context& context) override;
+
+        [[nodiscard]] size_t GetSize() const;
+
+        //    index;      .
+        //       runtime_error
+        [[nodiscard]] ObjectHolder GetItem(std::int64_t index) const;
+        void SetItem(std::int64_t index, ObjectHolder value);
+        void Append(ObjectHolder value);
+        //   .  ,    
+        void Clear();
+
+        // true,       
+        [[nodiscard]] bool HoldsIntegers() const {
+            return !boxed_;
+        }
+        //   ;      
+        [[nodiscard]] const std::vector<std::int64_t>& GetIntegers() const {
+            return integers_;
+        }
+        //    ;    ,       
+        [[nodiscard]] const std::vector<ObjectHolder>& GetObjects() const {
+            return objects_;
+        }
+
+        //   : Number  BigNumber  
+        [[nodiscard]] ObjectHolder SumIntegers() const;
+        //    .     runtime_error,
+        //      Less
+        [[nodiscard]] ObjectHolder Min(Context& context) const;
+        [[nodiscard]] ObjectHolder Max(Context& context) const;
+        //   .     ,
+        //   
+        void Sort(Context& context);
+
+        //    append(x)  sort().     runtime_error
+        ObjectHolder Call(const std::string& method, Arguments args, Context& context);
+
+        //   
+        [[nodiscard]] size_t GetHeapBytes() const {
+            return integers_.capacity() * sizeof(std::int64_t) + objects_.capacity() * sizeof(ObjectHolder);
+        }
+
+    private:
+        size_t GetPosition(std::int64_t index) const;
+        //     
+        void Box();
+        //      ,      
+        template <typename T>
+        void Reserve(std::vector<T>& items);
+        //        bytes
+        void ChargeStorage(size_t bytes);
+
+        std::vector<std::int64_t> integers_;
+        std::vector<ObjectHolder> objects_;
+        bool boxed_ = false;
+        MemoryCharge storage_charge_{ MemoryKind::List };
+        //     .      
+        //  ,      
+        size_t charged_bytes_ = 0;
+    };
+
+    //     :  -  ,   -  None
+    void PrintItem(std::ostream& os, const ObjectHolder& item, Context& context);
+
+    template <>
+    struct MemoryTraits<List> {
+        static constexpr MemoryKind KIND = MemoryKind::List;
+
+        static size_t GetExtraBytes(const List&) {
+            return 0;
+        }
     };
 
 
@@ -0,0 +1,268 @@
+#include "scheduler.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+using namespace std;
+
+namespace executor {
+
+    ScriptRun::ScriptRun(shared_ptr<runtime::Executable> program, runtime::Closure input, ostream& output,
+        uint64_t fuel_limit, shared_ptr<runtime::MemoryAccount> memory)
+        : program_(std::move(program))
+        , memory_(std::move(memory))
+        , closure_(std::move(input))
+        , budget_(fuel_limit)
+        , context_(output) {
+        {
+            const runtime::MemoryAccount::Scope memory_scope(memory_);
+            closure_charge_.emplace(closure_);
+        }
+        context_.SetBudget(&budget_);
+        context_.SetCycleCollector(&collector_);
+        if (const auto* compound = dynamic_cast<const ast::Compound*>(program_.get())) {
+            if (compound->GetStatementCount() != 0) {
+                frames_.push_back({ compound, 0 });
+            }
+            else {
+                finished_ = true;
+            }
+        }
+    }
+
+    ScriptRun::~ScriptRun() {
+        //        ,   .
+        // ,    ,     
+        const runtime::MemoryAccount::Scope memory_scope(memory_);
+        frames_.clear();
+        closure_charge_.reset();
+        closure_.clear();
+        collector_.Collect();
+    }
+
+    ScriptRun::StepResult ScriptRun::Step() {
+        if (finished_) {
+            return StepResult::Finished;
+        }
+        const runtime::MemoryAccount::Scope memory_scope(memory_);
+        if (frames_.empty()) {
+            //          
+            finished_ = true;
+            program_->Execute(closure_, context_);
+            return StepResult::Finished;
+        }
+
+        StepResult result = StepResult::Continue;
+        Frame& frame = frames_.back();
+        if (frame.loop != nullptr) {
+            if (frame.iteration->Next(closure_, context_)) {
+                result = Enter(frame.loop->GetBody());
+            }
+            else {
+                frames_.pop_back();
+            }
+        }
+        else {
+            runtime::Executable& statement = frame.compound->GetStatement(frame.next++);
+            result = Enter(statement);
+        }
+
+        //    ,   -    
+        while (!frames_.empty() && frames_.back().loop == nullptr
+            && frames_.back().next == frames_.back().compound->GetStatementCount()) {
+            frames_.pop_back();
+        }
+        if (frames_.empty()) {
+            finished_ = true;
+            return StepResult::Finished;
+        }
+        return result;
+    }
+
+    ScriptRun::StepResult ScriptRun::Enter(runtime::Executable& statement) {
+        if (const auto* compound = dynamic_cast<const ast::Compound*>(&statement)) {
+            if (compound->GetStatementCount() != 0) {
+                frames_.push_back({ compound, 0 });
+            }
+            return StepResult::Continue;
+        }
+        if (const auto* if_else = dynamic_cast<const ast::IfElse*>(&statement)) {
+            if (runtime::Executable* branch = if_else->SelectBranch(closure_, context_)) {
+                return Enter(*branch);
+            }
+            return StepResult::Continue;
+        }
+        if (const auto* loop = dynamic_cast<const ast::Loop*>(&statement)) {
+            frames_.push_back({ nullptr, 0, loop, loop->Start(closure_, context_) });
+            return StepResult::Continue;
+        }
+        // break  continue       ,   
+        if (dynamic_cast<const ast::Break*>(&statement) != nullptr) {
+            LeaveLoopBody(true);
+            return StepResult::Continue;
+        }
+        if (dynamic_cast<const ast::Continue*>(&statement) != nullptr) {
+            LeaveLoopBody(false);
+            return StepResult::Continue;
+        }
+        statement.Execute(closure_, context_);
+        return dynamic_cast<const ast::Print*>(&statement) != nullptr ? StepResult::Output : StepResult::Continue;
+    }
+
+    void ScriptRun::LeaveLoopBody(bool leave_loop) {
+        while (!frames_.empty() && frames_.back().loop == nullptr) {
+            frames_.pop_back();
+        }
+        if (leave_loop && !frames_.empty()) {
+            frames_.pop_back();
+        }
+    }
+
+    bool ScriptRun::IsFinished() const {
+        return finished_;
+    }
+
+    runtime::ExecutionBudget& ScriptRun::GetBudget() {
+        return budget_;
+    }
+
+    const runtime::MemoryAccount* ScriptRun::GetMemoryAccount() const {
+        return memory_.get();
+    }
+
+    CooperativeScheduler::CooperativeScheduler(SchedulerOptions options)
+        : options_(options) {
+        if (options_.thread_count == 0) {
+            options_.thread_count = max(thread::hardware_concurrency(), 1u);
+        }
+        options_.quantum = max<size_t>(options_.quantum, 1);
+    }
+
+    size_t CooperativeScheduler::ThreadCount() const {
+        return options_.thread_count;
+    }
+
+    BatchReport CooperativeScheduler::Run(vector<Job>& jobs) const {
+        BatchReport report;
+        report.jobs.resize(jobs.size());
+
+        vector<optional<ScriptRun>> scripts(jobs.size());
+        deque<size_t> ready;
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            ready.push_back(i);
+        }
+        size_t unfinished = jobs.size();
+        mutex queue_mutex;
+        condition_variable has_work;
+
+        const auto batch_start = Clock::now();
+
+        //   quantum  .  true,   
+        auto run_slice = [&](size_t index, JobResult& result) {
+            try {
+                if (!scripts[index]) {
+                    const Job& job = jobs[index];
+                    if (!job.program || job.output == nullptr) {
+                        throw invalid_argument("Job has no program or output"s);
+                    }
+                    scripts[index].emplace(job.program, job.input, *job.output, job.fuel_limit,
+                        job.CreateMemoryAccount());
+                }
+                ScriptRun& script = *scripts[index];
+                runtime::ExecutionBudget& budget = script.GetBudget();
+                if (options_.fuel_per_slice != 0) {
+                    budget.SetSlice(options_.fuel_per_slice);
+                }
+                for (size_t step = 0; step < options_.quantum; ++step) {
+                    const auto step_result = script.Step();
+                    result.fuel_used = budget.GetUsed();
+                    if (step_result == ScriptRun::StepResult::Finished) {
+                        result.ok = true;
+                        if (const auto* memory = script.GetMemoryAccount()) {
+                            result.memory = memory->GetStats();
+                        }
+                        return true;
+                    }
+                    if (step_result == ScriptRun::StepResult::Output && options_.yield_on_output) {
+                        break;
+                    }
+                    if (budget.IsPreemptionRequested()) {
+                        break;
+                    }
+                }
+                return false;
+            }
+            catch (const exception& e) {
+                result.error = e.what();
+            }
+            catch (...) {
+                result.error = "Unknown error"s;
+            }
+            if (scripts[index]) {
+                result.fuel_used = scripts[index]->GetBudget().GetUsed();
+                if (const auto* memory = scripts[index]->GetMemoryAccount()) {
+                    result.memory = memory->GetStats();
+                }
+            }
+            return true;
+        };
+
+        auto worker = [&](size_t worker_id) {
+            unique_lock lock(queue_mutex);
+            while (true) {
+                has_work.wait(lock, [&]() {
+                    return !ready.empty() || unfinished == 0;
+                });
+                if (ready.empty()) {
+                    return;
+                }
+                const size_t index = ready.front();
+                ready.pop_front();
+                lock.unlock();
+
+                JobResult& result = report.jobs[index];
+                const auto start = Clock::now();
+                const bool finished = run_slice(index, result);
+                const auto end = Clock::now();
+                result.run_time += end - start;
+                result.worker = worker_id;
+                if (finished) {
+                    //    :   Closure
+                    scripts[index].reset();
+                    result.queue_time = end - batch_start - result.run_time;
+                }
+
+                lock.lock();
+                if (finished) {
+                    if (--unfinished == 0) {
+                        has_work.notify_all();
+                    }
+                }
+                else {
+                    ready.push_back(index);
+                    has_work.notify_one();
+                }
+            }
+        };
+
+        const size_t worker_count = max<size_t>(min(options_.thread_count, jobs.size()), 1);
+        vector<thread> threads;
+        threads.reserve(worker_count - 1);
+        for (size_t i = 1; i < worker_count; ++i) {
+            threads.emplace_back(worker, i);
+        }
+        worker(0);
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        report.wall_time = Clock::now() - batch_start;
+        return report;
+    }
+
+}  // namespace executor
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "cycle_collector.h"
+#include "executor.h"
+#include "runtime.h"
+#include "statement.h"
+
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+namespace executor {
+
+    // ,      .
+    //          ,     ,
+    //        Closure   .  
+    //    ,      if/else   ;
+    //      .       :
+    //      ,     .   ,
+    //      ,    ,       ,
+    //   print.       fuel_limit .
+    //    memory,          .
+    //         
+    class ScriptRun {
+    public:
+        enum class StepResult {
+            //  ,   
+            Continue,
+            //   print
+            Output,
+            Finished,
+        };
+
+        ScriptRun(std::shared_ptr<runtime::Executable> program, runtime::Closure input, std::ostream& output,
+            uint64_t fuel_limit = runtime::ExecutionBudget::UNLIMITED,
+            std::shared_ptr<runtime::MemoryAccount> memory = nullptr);
+        ~ScriptRun();
+
+        ScriptRun(const ScriptRun&) = delete;
+        ScriptRun& operator=(const ScriptRun&) = delete;
+
+        //   .    
+        StepResult Step();
+
+        [[nodiscard]] bool IsFinished() const;
+
+        //   .      SetSlice   
+        //  ,     
+        [[nodiscard]] runtime::ExecutionBudget& GetBudget();
+
+        //     nullptr,    
+        [[nodiscard]] const runtime::MemoryAccount* GetMemoryAccount() const;
+
+    private:
+        //    :   compound  nullptr
+        struct Frame {
+            const ast::Compound* compound = nullptr;
+            size_t next = 0;
+            const ast::Loop* loop = nullptr;
+            std::unique_ptr<ast::Loop::Iteration> iteration;
+        };
+
+        //   ,     ,   
+        StepResult Enter(runtime::Executable& statement);
+        //       .  break    
+        void LeaveLoopBody(bool leave_loop);
+
+        std::shared_ptr<runtime::Executable> program_;
+        std::shared_ptr<runtime::MemoryAccount> memory_;
+        runtime::CycleCollector collector_;
+        runtime::Closure closure_;
+        //     memory_,     
+        std::optional<runtime::ClosureCharge> closure_charge_;
+        runtime::ExecutionBudget budget_;
+        runtime::SimpleContext context_;
+        std::vector<Frame> frames_;
+        bool finished_ = false;
+    };
+
+    struct SchedulerOptions {
+        // thread_count == 0 -   
+        size_t thread_count = 0;
+        //     ,    
+        size_t quantum = 16;
+        //       print. print      (. ScriptRun)
+        bool yield_on_output = false;
+        //       , 0 -  .
+        // ,  ,     ,    
+        //      
+        uint64_t fuel_per_slice = 0;
+    };
+
+    //       .
+    //      ,   quantum   
+    //     .    
+    //      
+    class CooperativeScheduler {
+    public:
+        explicit CooperativeScheduler(SchedulerOptions options = {});
+
+        [[nodiscard]] size_t ThreadCount() const;
+
+        //   queue_time  - ,     , run_time -  
+        //  , worker - ,   .  steals  
+        BatchReport Run(std::vector<Job>& jobs) const;
+
+    private:
+        SchedulerOptions options_;
+    };
+
+}  // namespace executor
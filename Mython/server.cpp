@@ -0,0 +1,275 @@
+#include "server.h"
+
+#include "cycle_collector.h"
+#include "lexer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <streambuf>
+
+using namespace std;
+
+namespace server {
+
+    namespace {
+
+        // ,     Output   
+        class SocketContext : public runtime::Context {
+        public:
+            SocketContext(net::LocalSocket& connection, size_t chunk_size)
+                : buffer_(connection, chunk_size)
+                , stream_(&buffer_) {
+            }
+
+            std::ostream& GetOutputStream() override {
+                return stream_;
+            }
+
+            void Write(string_view text) override {
+                buffer_.sputn(text.data(), static_cast<streamsize>(text.size()));
+            }
+
+            //   
+            void Flush() {
+                buffer_.pubsync();
+            }
+
+        private:
+            class FrameBuffer : public streambuf {
+            public:
+                FrameBuffer(net::LocalSocket& connection, size_t chunk_size)
+                    : connection_(connection)
+                    , data_(max<size_t>(chunk_size, 1), '\0') {
+                    setp(data_.data(), data_.data() + data_.size());
+                }
+
+            protected:
+                int_type overflow(int_type ch) override {
+                    SendPending();
+                    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+                        *pptr() = traits_type::to_char_type(ch);
+                        pbump(1);
+                    }
+                    return traits_type::not_eof(ch);
+                }
+
+                int sync() override {
+                    SendPending();
+                    return 0;
+                }
+
+            private:
+                void SendPending() {
+                    if (pptr() != pbase()) {
+                        net::SendFrame(connection_, net::FrameType::Output, { pbase(), static_cast<size_t>(pptr() - pbase()) });
+                        setp(data_.data(), data_.data() + data_.size());
+                    }
+                }
+
+                net::LocalSocket& connection_;
+                string data_;
+            };
+
+            FrameBuffer buffer_;
+            ostream stream_;
+        };
+
+    }  // namespace
+
+    ProgramCache::ProgramCache(size_t capacity, MethodParsing method_parsing)
+        : capacity_(max<size_t>(capacity, 1))
+        , method_parsing_(method_parsing) {
+    }
+
+    shared_ptr<runtime::Executable> ProgramCache::Get(const string& source) {
+        {
+            lock_guard guard(mutex_);
+            if (auto it = programs_.find(source); it != programs_.end()) {
+                ++hits_;
+                return it->second;
+            }
+        }
+        ++misses_;
+
+        //    :        ,
+        //     
+        istringstream input(source);
+        parse::Lexer lexer(input);
+        shared_ptr<runtime::Executable> program = ParseProgram(lexer, method_parsing_);
+
+        lock_guard guard(mutex_);
+        if (programs_.size() >= capacity_) {
+            programs_.clear();
+        }
+        return programs_.emplace(source, std::move(program)).first->second;
+    }
+
+    size_t ProgramCache::GetHits() const {
+        return hits_;
+    }
+
+    size_t ProgramCache::GetMisses() const {
+        return misses_;
+    }
+
+    Server::Server(string socket_path, ServerOptions options)
+        : socket_path_(std::move(socket_path))
+        , options_(options)
+        , cache_(options.cache_capacity, options.method_parsing) {
+        if (options_.thread_count == 0) {
+            options_.thread_count = max(thread::hardware_concurrency(), 1u);
+        }
+    }
+
+    Server::~Server() {
+        Stop();
+    }
+
+    void Server::Start() {
+        listener_ = net::LocalSocket::Listen(socket_path_);
+        stopping_ = false;
+        acceptor_ = thread([this]() {
+            AcceptLoop();
+        });
+        for (size_t i = 0; i < options_.thread_count; ++i) {
+            workers_.emplace_back([this]() {
+                WorkerLoop();
+            });
+        }
+    }
+
+    void Server::Stop() {
+        if (!acceptor_.joinable()) {
+            return;
+        }
+        {
+            lock_guard guard(mutex_);
+            stopping_ = true;
+            for (net::LocalSocket* connection : active_) {
+                connection->Shutdown();
+            }
+        }
+        has_connection_.notify_all();
+        listener_.Shutdown();
+        acceptor_.join();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+        workers_.clear();
+        pending_.clear();
+        listener_ = {};
+        remove(socket_path_.c_str());
+    }
+
+    const string& Server::GetSocketPath() const {
+        return socket_path_;
+    }
+
+    const ProgramCache& Server::GetCache() const {
+        return cache_;
+    }
+
+    size_t Server::GetRequestCount() const {
+        return request_count_;
+    }
+
+    void Server::AcceptLoop() {
+        while (true) {
+            net::LocalSocket connection = listener_.Accept();
+            lock_guard guard(mutex_);
+            if (stopping_) {
+                return;
+            }
+            if (connection.IsValid()) {
+                pending_.push_back(std::move(connection));
+                has_connection_.notify_one();
+            }
+        }
+    }
+
+    void Server::WorkerLoop() {
+        while (true) {
+            net::LocalSocket connection;
+            {
+                unique_lock lock(mutex_);
+                has_connection_.wait(lock, [this]() {
+                    return stopping_ || !pending_.empty();
+                });
+                if (stopping_) {
+                    return;
+                }
+                connection = std::move(pending_.front());
+                pending_.pop_front();
+                active_.insert(&connection);
+            }
+
+            try {
+                Serve(connection);
+            }
+            catch (const net::SocketError&) {
+                //    ,   
+            }
+
+            lock_guard guard(mutex_);
+            active_.erase(&connection);
+        }
+    }
+
+    void Server::Serve(net::LocalSocket& connection) {
+        net::FrameType type;
+        string source;
+        string input;
+        const size_t max_size = options_.max_frame_bytes;
+        try {
+            while (net::ReceiveFrame(connection, type, source, max_size)) {
+                if (type != net::FrameType::Program || !net::ReceiveFrame(connection, type, input, max_size)
+                    || type != net::FrameType::Input) {
+                    net::SendFrame(connection, net::FrameType::Error, "Protocol error: expected Program and Input frames"sv);
+                    return;
+                }
+                Execute(connection, source, input);
+            }
+        }
+        catch (const net::FrameTooLarge& e) {
+            //    ,     
+            net::SendFrame(connection, net::FrameType::Error, "Protocol error: "s + e.what());
+        }
+    }
+
+    void Server::Execute(net::LocalSocket& connection, const string& source, const string& input) {
+        ++request_count_;
+        SocketContext context(connection, options_.output_chunk_size);
+        runtime::ExecutionBudget budget(options_.fuel_limit);
+        context.SetBudget(&budget);
+        //     :   
+        shared_ptr<runtime::MemoryAccount> memory;
+        if (options_.memory_limit != runtime::MemoryAccount::UNLIMITED) {
+            memory = make_shared<runtime::MemoryAccount>(options_.memory_limit);
+        }
+        runtime::CycleCollector collector;
+        context.SetCycleCollector(&collector);
+        try {
+            //        ,     
+            auto program = cache_.Get(source);
+            const runtime::MemoryAccount::Scope memory_scope(memory);
+            runtime::Closure closure;
+            const runtime::ClosureCharge closure_charge(closure);
+            runtime::AssignVariable(closure, "stdin"s, runtime::ObjectHolder::Own(runtime::String(input)));
+            program->Execute(closure, context);
+        }
+        catch (const net::SocketError&) {
+            throw;
+        }
+        catch (const exception& e) {
+            context.Flush();
+            //      
+            const string_view message = e.what();
+            net::SendFrame(connection, net::FrameType::Error, message.empty() ? "Runtime error"sv : message);
+            return;
+        }
+        context.Flush();
+        net::SendFrame(connection, net::FrameType::Done, {});
+    }
+
+}  // namespace server
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "local_socket.h"
+#include "parse.h"
+#include "runtime.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace server {
+
+    //      .      ,
+    //          
+    class ProgramCache {
+    public:
+        explicit ProgramCache(size_t capacity, MethodParsing method_parsing = MethodParsing::Eager);
+
+        //   .    
+        std::shared_ptr<runtime::Executable> Get(const std::string& source);
+
+        [[nodiscard]] size_t GetHits() const;
+        [[nodiscard]] size_t GetMisses() const;
+
+    private:
+        size_t capacity_;
+        MethodParsing method_parsing_;
+        std::mutex mutex_;
+        std::unordered_map<std::string, std::shared_ptr<runtime::Executable>> programs_;
+        std::atomic<size_t> hits_{ 0 };
+        std::atomic<size_t> misses_{ 0 };
+    };
+
+    struct ServerOptions {
+        //  ,  . 0 -   
+        size_t thread_count = 0;
+        //      .    
+        size_t cache_capacity = 256;
+        MethodParsing method_parsing = MethodParsing::Eager;
+        //     (. runtime::ExecutionBudget)
+        uint64_t fuel_limit = runtime::ExecutionBudget::UNLIMITED;
+        //     (. runtime::MemoryAccount)
+        size_t memory_limit = runtime::MemoryAccount::UNLIMITED;
+        //          
+        size_t output_chunk_size = 16 * 1024;
+        //     .      
+        //   ,      
+        size_t max_frame_bytes = 16 * 1024 * 1024;
+    };
+
+    //  ,  Mython-,     Unix.
+    //       .  -  Program  Input
+    // (. net::FrameType).     Closure  Context,  
+    //      stdin.  -  Output    Done  Error
+    class Server {
+    public:
+        Server(std::string socket_path, ServerOptions options = {});
+        //  
+        ~Server();
+
+        Server(const Server&) = delete;
+        Server& operator=(const Server&) = delete;
+
+        //         
+        void Start();
+        //   ,      
+        void Stop();
+
+        [[nodiscard]] const std::string& GetSocketPath() const;
+        [[nodiscard]] const ProgramCache& GetCache() const;
+        [[nodiscard]] size_t GetRequestCount() const;
+
+    private:
+        void AcceptLoop();
+        void WorkerLoop();
+        void Serve(net::LocalSocket& connection);
+        void Execute(net::LocalSocket& connection, const std::string& source, const std::string& input);
+
+        std::string socket_path_;
+        ServerOptions options_;
+        ProgramCache cache_;
+        net::LocalSocket listener_;
+
+        std::mutex mutex_;
+        std::condition_variable has_connection_;
+        std::deque<net::LocalSocket> pending_;
+        // ,   . ,  Stop    
+        std::unordered_set<net::LocalSocket*> active_;
+        bool stopping_ = false;
+
+        std::atomic<size_t> request_count_{ 0 };
+        std::thread acceptor_;
+        std::vector<std::thread> workers_;
+    };
+
+}  // namespace server
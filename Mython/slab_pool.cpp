@@ -0,0 +1,184 @@
+#include "slab_pool.h"
+
+#include <cstdint>
+#include <mutex>
+
+using namespace std;
+
+namespace runtime {
+
+    struct alignas(alignof(max_align_t)) SlabPool::Slab {
+        SlabPool* pool;
+        //       
+        Slab* prev = nullptr;
+        Slab* next = nullptr;
+        //  ;      
+        void* free_list = nullptr;
+        //   unused        
+        char* unused;
+        size_t live = 0;
+
+        explicit Slab(SlabPool* owner)
+            : pool(owner)
+            , unused(reinterpret_cast<char*>(this) + sizeof(Slab)) {
+        }
+    };
+
+    namespace {
+
+        constexpr size_t ALIGNMENT = alignof(max_align_t);
+
+        size_t RoundUp(size_t bytes) {
+            return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        }
+
+    }  // namespace
+
+    void SlabPool::OwnerRelease::operator()(SlabPool* pool) const noexcept {
+        bool unused = false;
+        {
+            lock_guard<SpinLock> guard(pool->mutex_);
+            pool->orphaned_ = true;
+            unused = pool->stats_.occupied_slots == 0;
+        }
+        if (unused) {
+            delete pool;
+        }
+    }
+
+    SlabPool::Owner SlabPool::Create() {
+        return Owner(new SlabPool());
+    }
+
+    SlabPool::~SlabPool() {
+        while (partial_ != nullptr) {
+            Slab* slab = partial_;
+            Unlink(slab);
+            FreeSlab(slab);
+        }
+        if (spare_ != nullptr) {
+            FreeSlab(spare_);
+        }
+    }
+
+    void* SlabPool::Allocate(size_t bytes) {
+        bytes = RoundUp(bytes);
+        lock_guard<SpinLock> guard(mutex_);
+        if (stats_.slot_size == 0) {
+            if (bytes > SLAB_SIZE - sizeof(Slab)) {
+                return nullptr;
+            }
+            stats_.slot_size = bytes;
+            slots_per_slab_ = (SLAB_SIZE - sizeof(Slab)) / bytes;
+        }
+        else if (bytes != stats_.slot_size) {
+            return nullptr;
+        }
+
+        Slab* slab = partial_ != nullptr ? partial_ : TakeSlab();
+        void* result;
+        if (slab->free_list != nullptr) {
+            result = slab->free_list;
+            slab->free_list = *static_cast<void**>(result);
+        }
+        else {
+            result = slab->unused;
+            slab->unused += bytes;
+        }
+        if (++slab->live == slots_per_slab_) {
+            Unlink(slab);
+        }
+        ++stats_.allocations;
+        ++stats_.occupied_slots;
+        return result;
+    }
+
+    void SlabPool::Deallocate(void* ptr) noexcept {
+        //     ,     ,  
+        const auto address = reinterpret_cast<uintptr_t>(ptr) & ~static_cast<uintptr_t>(SLAB_SIZE - 1);
+        Slab* slab = reinterpret_cast<Slab*>(address);
+        SlabPool* pool = slab->pool;
+
+        bool unused = false;
+        {
+            lock_guard<SpinLock> guard(pool->mutex_);
+            const bool was_full = slab->live == pool->slots_per_slab_;
+            *static_cast<void**>(ptr) = slab->free_list;
+            slab->free_list = ptr;
+            --slab->live;
+            --pool->stats_.occupied_slots;
+
+            if (slab->live == 0) {
+                if (!was_full) {
+                    pool->Unlink(slab);
+                }
+                if (pool->spare_ == nullptr && !pool->orphaned_) {
+                    slab->~Slab();
+                    pool->spare_ = new (slab) Slab(pool);
+                }
+                else {
+                    pool->FreeSlab(slab);
+                }
+            }
+            else if (was_full) {
+                slab->next = pool->partial_;
+                if (pool->partial_ != nullptr) {
+                    pool->partial_->prev = slab;
+                }
+                pool->partial_ = slab;
+            }
+            unused = pool->orphaned_ && pool->stats_.occupied_slots == 0;
+        }
+        if (unused) {
+            delete pool;
+        }
+    }
+
+    bool SlabPool::HoldsSize(size_t bytes) const {
+        //           
+        return RoundUp(bytes) == stats_.slot_size;
+    }
+
+    SlabStats SlabPool::GetStats() const {
+        lock_guard<SpinLock> guard(mutex_);
+        return stats_;
+    }
+
+    SlabPool::Slab* SlabPool::TakeSlab() {
+        Slab* slab = spare_;
+        if (slab != nullptr) {
+            spare_ = nullptr;
+        }
+        else {
+            slab = new (::operator new(SLAB_SIZE, align_val_t{ SLAB_SIZE })) Slab(this);
+            ++stats_.slabs;
+            ++stats_.slabs_allocated;
+        }
+        slab->next = partial_;
+        if (partial_ != nullptr) {
+            partial_->prev = slab;
+        }
+        partial_ = slab;
+        return slab;
+    }
+
+    void SlabPool::Unlink(Slab* slab) noexcept {
+        if (slab->prev != nullptr) {
+            slab->prev->next = slab->next;
+        }
+        else {
+            partial_ = slab->next;
+        }
+        if (slab->next != nullptr) {
+            slab->next->prev = slab->prev;
+        }
+        slab->prev = slab->next = nullptr;
+    }
+
+    void SlabPool::FreeSlab(Slab* slab) noexcept {
+        slab->~Slab();
+        ::operator delete(slab, align_val_t{ SLAB_SIZE });
+        --stats_.slabs;
+    }
+
+}  // namespace runtime
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "memory_account.h"
+
+#include <cstddef>
+#include <memory>
+#include <atomic>
+#include <new>
+#include <thread>
+
+namespace runtime {
+
+    struct SlabStats {
+        //  ; 0,      
+        size_t slot_size = 0;
+        size_t allocations = 0;
+        //  ,     ,    
+        //     
+        size_t occupied_slots = 0;
+        // ,    ,        
+        size_t slabs = 0;
+        size_t slabs_allocated = 0;
+    };
+
+    //    .      SLAB_SIZE ,    
+    //   . ,     ,  
+    //    .      
+    class SlabPool {
+    public:
+        static constexpr size_t SLAB_SIZE = 16 * 1024;
+
+        struct OwnerRelease {
+            void operator()(SlabPool* pool) const noexcept;
+        };
+        using Owner = std::unique_ptr<SlabPool, OwnerRelease>;
+
+        [[nodiscard]] static Owner Create();
+
+        SlabPool(const SlabPool&) = delete;
+        SlabPool& operator=(const SlabPool&) = delete;
+
+        //    bytes.     ;  
+        //    nullptr
+        void* Allocate(size_t bytes);
+        //  ,   Allocate.      
+        static void Deallocate(void* ptr) noexcept;
+
+        //  true,    bytes    
+        [[nodiscard]] bool HoldsSize(size_t bytes) const;
+
+        [[nodiscard]] SlabStats GetStats() const;
+
+    private:
+        struct Slab;
+
+        SlabPool() = default;
+        ~SlabPool();
+
+        Slab* TakeSlab();
+        void Unlink(Slab* slab) noexcept;
+        void FreeSlab(Slab* slab) noexcept;
+
+        //     ,   
+        class SpinLock {
+        public:
+            void lock() noexcept {
+                while (locked_.exchange(true, std::memory_order_acquire)) {
+                    while (locked_.load(std::memory_order_relaxed)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            void unlock() noexcept {
+                locked_.store(false, std::memory_order_release);
+            }
+
+        private:
+            std::atomic<bool> locked_{ false };
+        };
+
+        mutable SpinLock mutex_;
+        //    
+        Slab* partial_ = nullptr;
+        //  ,    
+        Slab* spare_ = nullptr;
+        size_t slots_per_slab_ = 0;
+        bool orphaned_ = false;
+        SlabStats stats_;
+    };
+
+    //   std::allocate_shared,        .
+    //   ,    ,   AccountingAllocator
+    template <typename T>
+    class SlabAllocator {
+    public:
+        using value_type = T;
+
+        SlabAllocator(SlabPool& pool, std::shared_ptr<MemoryAccount> account, MemoryKind kind, size_t extra_bytes)
+            : pool_(&pool)
+            , account_(std::move(account))
+            , kind_(kind)
+            , extra_bytes_(extra_bytes) {
+        }
+
+        template <typename U>
+        SlabAllocator(const SlabAllocator<U>& other) noexcept  // NOLINT(google-explicit-constructor)
+            : pool_(other.pool_)
+            , account_(other.account_)
+            , kind_(other.kind_)
+            , extra_bytes_(other.extra_bytes_) {
+        }
+
+        T* allocate(size_t n) {
+            static_assert(alignof(T) <= alignof(std::max_align_t));
+            if (account_) {
+                account_->Allocate(kind_, n * sizeof(T) + extra_bytes_);
+            }
+            try {
+                void* ptr = n == 1 ? pool_->Allocate(sizeof(T)) : nullptr;
+                return static_cast<T*>(ptr != nullptr ? ptr : ::operator new(n * sizeof(T)));
+            }
+            catch (...) {
+                if (account_) {
+                    account_->Release(kind_, n * sizeof(T) + extra_bytes_);
+                }
+                throw;
+            }
+        }
+
+        void deallocate(T* ptr, size_t n) noexcept {
+            //  ,     ,   Deallocate    
+            if (n == 1 && pool_->HoldsSize(sizeof(T))) {
+                SlabPool::Deallocate(ptr);
+            }
+            else {
+                ::operator delete(ptr);
+            }
+            if (account_) {
+                account_->Release(kind_, n * sizeof(T) + extra_bytes_);
+            }
+        }
+
+        template <typename U>
+        bool operator==(const SlabAllocator<U>& other) const noexcept {
+            return pool_ == other.pool_ && account_ == other.account_;
+        }
+
+        template <typename U>
+        bool operator!=(const SlabAllocator<U>& other) const noexcept {
+            return !(*this == other);
+        }
+
+    private:
+        template <typename U>
+        friend class SlabAllocator;
+
+        SlabPool* pool_;
+        std::shared_ptr<MemoryAccount> account_;
+        MemoryKind kind_;
+        size_t extra_bytes_;
+    };
+
+}  // namespace runtime
@@ -0,0 +1,129 @@
+#include "snapshot.h"
+
+#include "cycle_collector.h"
+#include "dict.h"
+#include "lexer.h"
+
+#include <istream>
+#include <unordered_map>
+
+using namespace std;
+
+namespace {
+
+    using runtime::ObjectHolder;
+
+    //   ,   ,     ,    
+    class InstanceCloner {
+    public:
+        explicit InstanceCloner(runtime::CycleCollector* collector)
+            : collector_(collector) {
+        }
+
+        ObjectHolder Clone(const ObjectHolder& value) {
+            if (auto it = copies_.find(value.Get()); it != copies_.end()) {
+                return it->second;
+            }
+            if (const auto* list = value.TryAs<runtime::List>()) {
+                return CloneList(*list);
+            }
+            if (const auto* dict = value.TryAs<runtime::Dict>()) {
+                return CloneDict(*dict);
+            }
+            const auto* instance = value.TryAs<runtime::ClassInstance>();
+            if (instance == nullptr) {
+                return value;
+            }
+
+            ObjectHolder copy = ObjectHolder::Own(runtime::ClassInstance(instance->GetClass()));
+            Register(instance, copy);
+            //    SetField,        
+            auto* fields = copy.TryAs<runtime::ClassInstance>();
+            for (const auto& [name, field] : instance->Fields()) {
+                fields->SetField(name, Clone(field));
+            }
+            return copy;
+        }
+
+    private:
+        // ,   ,  ,   ,   
+        void Register(const runtime::Object* original, const ObjectHolder& copy) {
+            copies_.emplace(original, copy);
+            if (collector_ != nullptr) {
+                collector_->Track(copy);
+            }
+        }
+
+        ObjectHolder CloneList(const runtime::List& list) {
+            //    ,      
+            ObjectHolder copy = ObjectHolder::Own(runtime::List(list));
+            Register(&list, copy);
+            auto* items = copy.TryAs<runtime::List>();
+            for (size_t i = 0; i < list.GetObjects().size(); ++i) {
+                items->SetItem(static_cast<int64_t>(i), Clone(list.GetObjects()[i]));
+            }
+            return copy;
+        }
+
+        ObjectHolder CloneDict(const runtime::Dict& dict) {
+            //      ,   __hash__   
+            ObjectHolder copy = ObjectHolder::Own(runtime::Dict(dict));
+            Register(&dict, copy);
+            copy.TryAs<runtime::Dict>()->TransformEntries([this](const ObjectHolder& item) {
+                return Clone(item);
+            });
+            return copy;
+        }
+
+        runtime::CycleCollector* collector_;
+        unordered_map<const runtime::Object*, ObjectHolder> copies_;
+    };
+
+}  // namespace
+
+shared_ptr<const PreludeSnapshot> PreludeSnapshot::Create(istream& prelude, ostream& output,
+    MethodParsing method_parsing) {
+    shared_ptr<PreludeSnapshot> snapshot(new PreludeSnapshot());
+    snapshot->method_parsing_ = method_parsing;
+
+    parse::Lexer lexer(prelude);
+    snapshot->prelude_ = ParseProgram(lexer, method_parsing);
+
+    runtime::SimpleContext context{ output };
+    context.SetCycleCollector(&snapshot->collector_);
+    snapshot->prelude_->Execute(snapshot->globals_, context);
+
+    for (const auto& [name, value] : snapshot->globals_) {
+        snapshot->has_instances_ = snapshot->has_instances_ || value.TryAs<runtime::ClassInstance>() != nullptr
+            || value.TryAs<runtime::List>() != nullptr || value.TryAs<runtime::Dict>() != nullptr;
+    }
+    return snapshot;
+}
+
+unique_ptr<runtime::Executable> PreludeSnapshot::Parse(parse::Lexer& lexer) const {
+    return ParseProgram(lexer, globals_, method_parsing_);
+}
+
+runtime::Closure PreludeSnapshot::Clone(runtime::CycleCollector* collector) const {
+    if (!has_instances_) {
+        return globals_;
+    }
+    runtime::Closure result;
+    result.reserve(globals_.size());
+    InstanceCloner cloner(collector);
+    for (const auto& [name, value] : globals_) {
+        result.emplace(name, cloner.Clone(value));
+    }
+    return result;
+}
+
+void PreludeSnapshot::Run(istream& program, runtime::Context& context) const {
+    parse::Lexer lexer(program);
+    auto parsed = Parse(lexer);
+    runtime::Closure closure = Clone(context.GetCycleCollector());
+    parsed->Execute(closure, context);
+}
+
+const runtime::Closure& PreludeSnapshot::GetGlobals() const {
+    return globals_;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "cycle_collector.h"
+#include "parse.h"
+#include "runtime.h"
+
+#include <iosfwd>
+#include <memory>
+
+//     : AST ,    
+//   .     ,    
+//   .    ,    
+class PreludeSnapshot {
+public:
+    //    ,     output
+    static std::shared_ptr<const PreludeSnapshot> Create(std::istream& prelude, std::ostream& output,
+        MethodParsing method_parsing = MethodParsing::Eager);
+
+    //   .    
+    [[nodiscard]] std::unique_ptr<runtime::Executable> Parse(parse::Lexer& lexer) const;
+
+    //      .
+    //     (, ,  )   ,
+    //    ,   ,     .  
+    //     ,   ,    .
+    //       ,   collector,  
+    [[nodiscard]] runtime::Closure Clone(runtime::CycleCollector* collector = nullptr) const;
+
+    //          
+    void Run(std::istream& program, runtime::Context& context) const;
+
+    [[nodiscard]] const runtime::Closure& GetGlobals() const;
+
+private:
+    PreludeSnapshot() = default;
+
+    std::shared_ptr<runtime::Executable> prelude_;
+    //       ,    globals_
+    runtime::CycleCollector collector_;
+    runtime::Closure globals_;
+    MethodParsing method_parsing_ = MethodParsing::Eager;
+    bool has_instances_ = false;
+};
@@ -1,7 +1,14 @@
 #include "statement.h"
 
+#include "cycle_collector.h"
+#include "dict.h"
+#include "frame_stack.h"
+
+#include <array>
+#include <functional>
 #include <iostream>
 #include <sstream>
+#include <typeinfo>
 
 using namespace std;
 
@@ -14,11 +21,353 @@ namespace ast {
     namespace {
         const string ADD_METHOD = "__add__"s;
         const string INIT_METHOD = "__init__"s;
+
+        // Number, Float  BigNumber   ,   dynamic_cast 
+        //   .      ,    
+        template <typename T>
+        const T* TryAsExactly(const ObjectHolder& object) {
+            const runtime::Object* ptr = object.Get();
+            return ptr != nullptr && typeid(*ptr) == typeid(T) ? static_cast<const T*>(ptr) : nullptr;
+        }
+
+        //    double. number  floating -    object
+        bool GetDouble(const ObjectHolder& object, const runtime::Number* number, const runtime::Float* floating,
+                       double* value) {
+            if (floating != nullptr) {
+                *value = floating->GetValue();
+                return true;
+            }
+            if (number != nullptr) {
+                *value = static_cast<double>(number->GetValue());
+                return true;
+            }
+            return runtime::TryGetFloat(object, value);
+        }
+
+        //    .  Number   64   
+        // ,    -  BigInteger,      BigNumber.
+        //      Float,    double.
+        //  false,       
+        template <bool (*Checked)(int64_t, int64_t, int64_t*), typename Exact, typename Floating>
+        bool TryNumericOperation(const ObjectHolder& lhs, const ObjectHolder& rhs, Exact exact, Floating floating,
+                                 ObjectHolder* result) {
+            const auto* l = TryAsExactly<runtime::Number>(lhs);
+            const auto* r = TryAsExactly<runtime::Number>(rhs);
+            if (l != nullptr && r != nullptr) {
+                int64_t value;
+                if (Checked(l->GetValue(), r->GetValue(), &value)) {
+                    *result = ObjectHolder::Own(runtime::Number(value));
+                }
+                else {
+                    *result = runtime::MakeInteger(exact(runtime::BigInteger(l->GetValue()),
+                                                         runtime::BigInteger(r->GetValue())));
+                }
+                return true;
+            }
+
+            const auto* l_float = l == nullptr ? TryAsExactly<runtime::Float>(lhs) : nullptr;
+            const auto* r_float = r == nullptr ? TryAsExactly<runtime::Float>(rhs) : nullptr;
+            if (l_float != nullptr || r_float != nullptr) {
+                double l_value;
+                double r_value;
+                if (GetDouble(lhs, l, l_float, &l_value) && GetDouble(rhs, r, r_float, &r_value)) {
+                    *result = ObjectHolder::Own(runtime::Float(floating(l_value, r_value)));
+                    return true;
+                }
+                return false;
+            }
+
+            if ((l == nullptr && TryAsExactly<runtime::BigNumber>(lhs) == nullptr)
+                || (r == nullptr && TryAsExactly<runtime::BigNumber>(rhs) == nullptr)) {
+                return false;
+            }
+            runtime::BigInteger big_l;
+            runtime::BigInteger big_r;
+            if (runtime::TryGetInteger(lhs, &big_l) && runtime::TryGetInteger(rhs, &big_r)) {
+                *result = runtime::MakeInteger(exact(big_l, big_r));
+                return true;
+            }
+            return false;
+        }
+
+        runtime::List& AsList(const ObjectHolder& object) {
+            auto* list = object.TryAs<runtime::List>();
+            if (list == nullptr) {
+                throw runtime_error("");
+            }
+            return *list;
+        }
+
+        int64_t AsIndex(const ObjectHolder& object) {
+            const auto* index = TryAsExactly<runtime::Number>(object);
+            if (index == nullptr) {
+                throw runtime_error("");
+            }
+            return index->GetValue();
+        }
+
+        //  break, continue  return.    : break  continue 
+        //  , return -  
+        class Signal : public runtime::Object {
+        public:
+            void Print([[maybe_unused]] std::ostream& os, [[maybe_unused]] Context& context) override {
+            }
+        };
+
+        Signal break_signal;
+        Signal continue_signal;
+        Signal return_signal;
+        const ObjectHolder BREAK_SIGNAL = ObjectHolder::Share(break_signal);
+        const ObjectHolder CONTINUE_SIGNAL = ObjectHolder::Share(continue_signal);
+        const ObjectHolder RETURN_SIGNAL = ObjectHolder::Share(return_signal);
+
+        //   return.  return        ,
+        //       
+        thread_local ObjectHolder return_value;
+
+        bool IsSignal(const ObjectHolder& result) {
+            const runtime::Object* ptr = result.Get();
+            return ptr == &break_signal || ptr == &continue_signal || ptr == &return_signal;
+        }
+
+        //   for.         :
+        //   Closure  ,      
+        class LoopVariable {
+        public:
+            LoopVariable(Closure& closure, const string& name)
+                : closure_(closure)
+                , name_(name) {
+            }
+
+            void Set(ObjectHolder value) {
+                if (slot_ == nullptr) {
+                    slot_ = &runtime::AssignVariable(closure_, name_, std::move(value));
+                }
+                else {
+                    *slot_ = std::move(value);
+                }
+            }
+
+            // ,     ,    , 
+            //      ,      .
+            //    ,     
+            void SetInteger(int64_t value) {
+                if (slot_ == nullptr) {
+                    if (auto it = closure_.find(name_); it != closure_.end()) {
+                        slot_ = &it->second;
+                    }
+                }
+                if (slot_ != nullptr && slot_->IsUnique()) {
+                    runtime::Object* ptr = slot_->Get();
+                    if (typeid(*ptr) == typeid(runtime::Number)) {
+                        static_cast<runtime::Number*>(ptr)->SetValue(value);
+                        return;
+                    }
+                }
+                Set(ObjectHolder::Own(runtime::Number(value)));
+            }
+
+        private:
+            Closure& closure_;
+            const string& name_;
+            ObjectHolder* slot_ = nullptr;
+        };
+
+        //  .   final,   RunLoop  Next  
+        class WhileIteration final : public Loop::Iteration {
+        public:
+            explicit WhileIteration(Statement& condition)
+                : condition_(condition) {
+            }
+
+            bool Next(Closure& closure, Context& context) override {
+                if (!runtime::IsTrue(condition_.Execute(closure, context))) {
+                    return false;
+                }
+                //     ,      
+                context.ChargeFuel();
+                return true;
+            }
+
+        private:
+            Statement& condition_;
+        };
+
+        class RangeIteration final : public Loop::Iteration {
+        public:
+            RangeIteration(Closure& closure, Context& context, const string& var, Statement* start,
+                Statement& stop, Statement* step)
+                : variable_(closure, var)
+                , value_(start != nullptr ? AsIndex(start->Execute(closure, context)) : 0)
+                , stop_(AsIndex(stop.Execute(closure, context)))
+                , step_(step != nullptr ? AsIndex(step->Execute(closure, context)) : 1) {
+                if (step_ == 0) {
+                    throw runtime_error("range() step must not be zero"s);
+                }
+            }
+
+            bool Next([[maybe_unused]] Closure& closure, Context& context) override {
+                if (done_ || (step_ > 0 ? value_ >= stop_ : value_ <= stop_)) {
+                    return false;
+                }
+                context.ChargeFuel();
+                variable_.SetInteger(value_);
+                //     int64      stop
+                done_ = !runtime::CheckedAdd(value_, step_, &value_);
+                return true;
+            }
+
+        private:
+            LoopVariable variable_;
+            int64_t value_;
+            const int64_t stop_;
+            const int64_t step_;
+            bool done_ = false;
+        };
+
+        //      ,       .
+        //      :    
+        class ListIteration final : public Loop::Iteration {
+        public:
+            ListIteration(Closure& closure, const string& var, ObjectHolder list)
+                : variable_(closure, var)
+                , holder_(std::move(list))
+                , list_(*holder_.TryAs<runtime::List>()) {
+            }
+
+            bool Next([[maybe_unused]] Closure& closure, Context& context) override {
+                if (index_ >= list_.GetSize()) {
+                    return false;
+                }
+                context.ChargeFuel();
+                if (list_.HoldsIntegers()) {
+                    variable_.SetInteger(list_.GetIntegers()[index_]);
+                }
+                else {
+                    variable_.Set(list_.GetObjects()[index_]);
+                }
+                ++index_;
+                return true;
+            }
+
+        private:
+            LoopVariable variable_;
+            const ObjectHolder holder_;
+            const runtime::List& list_;
+            size_t index_ = 0;
+        };
+
+        class DictIteration final : public Loop::Iteration {
+        public:
+            DictIteration(Closure& closure, const string& var, ObjectHolder dict)
+                : variable_(closure, var)
+                , holder_(std::move(dict))
+                , dict_(*holder_.TryAs<runtime::Dict>())
+                , version_(dict_.GetVersion()) {
+            }
+
+            bool Next([[maybe_unused]] Closure& closure, Context& context) override {
+                if (dict_.GetVersion() != version_) {
+                    throw runtime_error("Dict changed size during iteration"s);
+                }
+                const auto& entries = dict_.GetEntries();
+                while (index_ < entries.size() && entries[index_].erased) {
+                    ++index_;
+                }
+                if (index_ == entries.size()) {
+                    return false;
+                }
+                context.ChargeFuel();
+                variable_.Set(entries[index_].key);
+                ++index_;
+                return true;
+            }
+
+        private:
+            LoopVariable variable_;
+            const ObjectHolder holder_;
+            const runtime::Dict& dict_;
+            const uint64_t version_;
+            size_t index_ = 0;
+        };
+
+        //  ,         break  return.
+        //  return  , break  
+        template <typename Iteration>
+        ObjectHolder RunLoop(Iteration& iteration, Statement& body, Closure& closure, Context& context) {
+            while (iteration.Next(closure, context)) {
+                ObjectHolder result = body.Execute(closure, context);
+                if (result.Get() == &break_signal) {
+                    break;
+                }
+                if (result.Get() == &return_signal) {
+                    return result;
+                }
+            }
+            return {};
+        }
+
+        bool CheckedDivide(int64_t lhs, int64_t rhs, int64_t* result) {
+            if (rhs == 0) {
+                throw runtime_error("");
+            }
+            return runtime::CheckedDivide(lhs, rhs, result);
+        }
+
+        runtime::BigInteger Divide(const runtime::BigInteger& lhs, const runtime::BigInteger& rhs) {
+            if (rhs.IsZero()) {
+                throw runtime_error("");
+            }
+            return lhs / rhs;
+        }
+
+        double DivideFloat(double lhs, double rhs) {
+            if (rhs == 0.0) {
+                throw runtime_error("");
+            }
+            return lhs / rhs;
+        }
+
+        //   ,   print  .
+        //  print (,   __str__)      
+        thread_local string print_line_buffer;
+
+        enum class CanonicalStringId { None, True, False };
+
+        //  "None", "True"  "False",     str.
+        //    ,       ,
+        //   str  
+        const ObjectHolder& CanonicalString(CanonicalStringId id) {
+            static const array<ObjectHolder, 3> strings = [] {
+                const runtime::MemoryAccount::Scope no_account(nullptr);
+                return array<ObjectHolder, 3>{
+                    ObjectHolder::Own(runtime::String("None"s)),
+                    ObjectHolder::Own(runtime::String("True"s)),
+                    ObjectHolder::Own(runtime::String("False"s)),
+                };
+            }();
+            return strings[static_cast<size_t>(id)];
+        }
+
+        void RenderValue(const ObjectHolder& value, string& out, Context& context) {
+            if (value) {
+                value->Render(out, context);
+            }
+            else {
+                out += "None"sv;
+            }
+        }
+        //    None,   .    operator[],   ,
+        //    Closure   AssignVariable     
+        ObjectHolder FindVariable(const Closure& closure, const std::string& name) {
+            auto it = closure.find(name);
+            return it != closure.end() ? it->second : ObjectHolder::None();
+        }
+
     }  // namespace
 
     ObjectHolder Assignment::Execute(Closure& closure, Context& context) {
-        closure[var_] = rv_.get()->Execute(closure, context);
-        return rv_.get()->Execute(closure, context);
+        return runtime::AssignVariable(closure, var_, rv_.get()->Execute(closure, context));
     }
 
     Assignment::Assignment(std::string var, std::unique_ptr<Statement> rv) : var_(var), rv_(std::move(rv)) {
@@ -32,8 +381,9 @@ namespace ast {
 
     ObjectHolder VariableValue::Execute(Closure& closure, Context& context) {
         if (!var_name_.empty()) {
-            if (closure.count(var_name_)) {
-                return closure[var_name_];
+            auto it = closure.find(var_name_);
+            if (it != closure.end()) {
+                return it->second;
             }
             else {
                 throw runtime_error("");
@@ -41,15 +391,16 @@ namespace ast {
         }
         if (!dotted_ids_.empty()) {
             ObjectHolder chain;
-            chain = closure[dotted_ids_[0]];
+            chain = FindVariable(closure, dotted_ids_[0]);
             for (size_t i = 1; i < dotted_ids_.size(); i++) {
                 if (chain.Get()) {
-                    if(chain.TryAs<runtime::ClassInstance>()->Fields().count(dotted_ids_[i])) {
-                        chain = chain.TryAs<runtime::ClassInstance>()->Fields()[dotted_ids_[i]];
+                    const auto& fields = chain.TryAs<runtime::ClassInstance>()->Fields();
+                    if (auto it = fields.find(dotted_ids_[i]); it != fields.end()) {
+                        chain = it->second;
                     }
                 }
                 else {
-                    chain = closure[dotted_ids_[i]];
+                    chain = FindVariable(closure, dotted_ids_[i]);
                 }
             }
             return chain;
@@ -69,35 +420,26 @@ namespace ast {
     }
 
     ObjectHolder Print::Execute(Closure& closure, Context& context) {
-        // .   
+        //          Write
+        string line = std::move(print_line_buffer);
+        line.clear();
+
+        ObjectHolder result;
         if (argument_ != nullptr) {
-            argument_.get()->Execute(closure, context).Get()->Print(context.GetOutputStream(), context);
-            context.GetOutputStream() << "\n";
-            return argument_.get()->Execute(closure, context);
-        }
-        if (!args_.empty()) {
-            for (size_t i = 0; i < args_.size();i++) {
-                if (auto a = args_[i].get()->Execute(closure, context)) {
-                    if (a.operator bool()) {
-                        if (i == 0) {
-                           a.Get()->Print(context.GetOutputStream(), context);
-                        }
-                        else {
-                            context.GetOutputStream() << " ";
-
-                            a.Get()->Print(context.GetOutputStream(), context);
-                        }
-                    }
-                }
-                else {
-                    i==0 ? context.GetOutputStream() << "None" : context.GetOutputStream() << " None";
-                }
+            result = argument_.get()->Execute(closure, context);
+            RenderValue(result, line, context);
+        }
+        for (size_t i = 0; i < args_.size(); i++) {
+            if (i != 0) {
+                line += ' ';
             }
-            context.GetOutputStream() << "\n";
-            return {};
+            RenderValue(args_[i].get()->Execute(closure, context), line, context);
         }
-        context.GetOutputStream() << "\n";
-        return {};
+        line += '\n';
+        context.Write(line);
+
+        print_line_buffer = std::move(line);
+        return result;
     }
 
     MethodCall::MethodCall(std::unique_ptr<Statement> object, std::string method,
@@ -107,54 +449,109 @@ namespace ast {
 
     //   object.method    args
     ObjectHolder MethodCall::Execute(Closure& closure, Context& context ) {
-        std::vector<runtime::ObjectHolder> args;
+        //       
+        runtime::FrameStack::ArgumentFrame args(runtime::FrameStack::ForThread());
         for (const auto& arg : args_) {
-            args.push_back(arg.get()->Execute(closure, context));
+            args.Push(arg.get()->Execute(closure, context));
+        }
+        ObjectHolder object = object_.get()->Execute(closure, context);
+        if (auto* instance = object.TryAs<runtime::ClassInstance>()) {
+            return instance->Call(method_, args.Get(), context);
+        }
+        if (auto* list = object.TryAs<runtime::List>()) {
+            return list->Call(method_, args.Get(), context);
+        }
+        if (auto* dict = object.TryAs<runtime::Dict>()) {
+            return dict->Call(method_, args.Get(), context);
         }
-        return object_.get()->Execute(closure, context).TryAs<runtime::ClassInstance>()->Call(method_, args, context);
+        throw runtime_error("");
     }
 
     ObjectHolder Stringify::Execute(Closure& closure, Context& context) {
-        // .   
-        ObjectHolder holder;
-        std::ostringstream stream;
-        if (argument_.get()->Execute(closure, context).Get()) {
-            argument_.get()->Execute(closure, context).Get()->Print(stream, context);
-            runtime::String s(stream.str());
-            holder = holder.Own(std::move(s));
+        ObjectHolder value = argument_.get()->Execute(closure, context);
+        if (!value) {
+            return CanonicalString(CanonicalStringId::None);
         }
-        else {
-            runtime::String s("None");
-            holder = holder.Own(std::move(s));
+        //  ,  str      
+        if (value.TryAs<runtime::String>()) {
+            return value;
         }
-        return holder;
+        if (const auto* boolean = value.TryAs<runtime::Bool>()) {
+            return CanonicalString(boolean->GetValue() ? CanonicalStringId::True : CanonicalStringId::False);
+        }
+
+        std::string text;
+        value->Render(text, context);
+        return ObjectHolder::Own(runtime::String(std::move(text)));
     }
     
+    ObjectHolder Length::Execute(Closure& closure, Context& context) {
+        ObjectHolder value = argument_.get()->Execute(closure, context);
+        if (const auto* list = value.TryAs<runtime::List>()) {
+            return ObjectHolder::Own(runtime::Number(static_cast<int64_t>(list->GetSize())));
+        }
+        if (const auto* dict = value.TryAs<runtime::Dict>()) {
+            return ObjectHolder::Own(runtime::Number(static_cast<int64_t>(dict->GetSize())));
+        }
+        if (const auto* str = value.TryAs<runtime::String>()) {
+            return ObjectHolder::Own(runtime::Number(static_cast<int64_t>(str->GetValue().size())));
+        }
+        throw runtime_error("");
+    }
+
+    ObjectHolder Sum::Execute(Closure& closure, Context& context) {
+        ObjectHolder value = argument_.get()->Execute(closure, context);
+        const runtime::List& list = AsList(value);
+        if (list.HoldsIntegers()) {
+            return list.SumIntegers();
+        }
+        //      +,   
+        ObjectHolder total = ObjectHolder::Own(runtime::Number(0));
+        for (const auto& item : list.GetObjects()) {
+            ObjectHolder next;
+            if (!TryNumericOperation<runtime::CheckedAdd>(total, item, std::plus<>{}, std::plus<>{}, &next)) {
+                throw runtime_error("");
+            }
+            total = std::move(next);
+        }
+        return total;
+    }
+
+    ObjectHolder Minimum::Execute(Closure& closure, Context& context) {
+        ObjectHolder value = argument_.get()->Execute(closure, context);
+        return AsList(value).Min(context);
+    }
+
+    ObjectHolder Maximum::Execute(Closure& closure, Context& context) {
+        ObjectHolder value = argument_.get()->Execute(closure, context);
+        return AsList(value).Max(context);
+    }
+
     ObjectHolder Add::Execute(Closure& closure, Context& context) {
         auto lhs = lhs_.get()->Execute(closure, context);
         auto rhs = rhs_.get()->Execute(closure, context);
-        if (auto ptr_l = lhs.TryAs<runtime::Number>()) {
-            if (auto ptr_r = rhs.TryAs<runtime::Number>()) {
-                ObjectHolder holder;
-                auto l = ptr_l->GetValue();
-                auto r = ptr_r->GetValue();
-                runtime::Number n(l + r);
-                holder = holder.Own(std::move(n));
-                return holder;
-            }
+        if (ObjectHolder result; TryNumericOperation<runtime::CheckedAdd>(lhs, rhs, std::plus<>{}, std::plus<>{}, &result)) {
+            return result;
         }
-        else if (auto ptr_l = lhs.TryAs< runtime::String>()) {
+        if (auto ptr_l = lhs.TryAs< runtime::String>()) {
             if (auto ptr_r = rhs.TryAs<runtime::String>()) {
                 ObjectHolder holder;
-                auto l = ptr_l->GetValue();
-                auto r = ptr_r->GetValue();
-                runtime::String s(l + r);
+                const auto& l = ptr_l->GetValue();
+                const auto& r = ptr_r->GetValue();
+                //     ,    
+                if (auto* account = runtime::MemoryAccount::Current()) {
+                    account->CheckAvailable(l.size() + r.size() + 1);
+                }
+                std::string concatenation;
+                concatenation.reserve(l.size() + r.size());
+                concatenation.append(l).append(r);
+                runtime::String s(std::move(concatenation));
                 holder = holder.Own(std::move(s));
                 return holder;
             }
         }
         else if (auto ptr_l = lhs.TryAs<runtime::ClassInstance>()) {
-            return ptr_l->Call(ADD_METHOD, { rhs_.get()->Execute(closure, context) }, context);
+            return ptr_l->Call(ADD_METHOD, runtime::Arguments{ &rhs, 1 }, context);
         }
         throw runtime_error("");
     }
@@ -162,91 +559,50 @@ namespace ast {
     ObjectHolder Sub::Execute(Closure& closure, Context& context) {
         auto lhs = lhs_.get()->Execute(closure, context);
         auto rhs = rhs_.get()->Execute(closure, context);
-        if (auto ptr_l = lhs.TryAs<runtime::Number>()) {
-            if (auto ptr_r = rhs.TryAs<runtime::Number>()) {
-                ObjectHolder holder;
-                auto l = ptr_l->GetValue();
-                auto r = ptr_r->GetValue();
-                runtime::Number n(l - r);
-                holder = holder.Own(std::move(n));
-                return holder;
-            }
-            else {
-                throw runtime_error("");
-            }
-        }
-        else {
-            throw runtime_error("");
+        if (ObjectHolder result; TryNumericOperation<runtime::CheckedSubtract>(lhs, rhs, std::minus<>{}, std::minus<>{}, &result)) {
+            return result;
         }
+        throw runtime_error("");
     }
 
     ObjectHolder Mult::Execute(Closure& closure, Context& context) {
         auto lhs = lhs_.get()->Execute(closure, context);
         auto rhs = rhs_.get()->Execute(closure, context);
-        if (auto ptr_l = lhs.TryAs<runtime::Number>()) {
-            if (auto ptr_r = rhs.TryAs<runtime::Number>()) {
-                ObjectHolder holder;
-                auto l = ptr_l->GetValue();
-                auto r = ptr_r->GetValue();
-                runtime::Number n(l * r);
-                holder = holder.Own(std::move(n));
-                return holder;
-            }
-            else {
-                throw runtime_error("");
-            }
-        }
-        else {
-            throw runtime_error("");
+        if (ObjectHolder result; TryNumericOperation<runtime::CheckedMultiply>(lhs, rhs, std::multiplies<>{}, std::multiplies<>{}, &result)) {
+            return result;
         }
+        throw runtime_error("");
     }
 
     ObjectHolder Div::Execute(Closure& closure, Context& context) {
         auto lhs = lhs_.get()->Execute(closure, context);
         auto rhs = rhs_.get()->Execute(closure, context);
-        if (auto ptr_l = lhs.TryAs<runtime::Number>()) {
-            if (auto ptr_r = rhs.TryAs<runtime::Number>()) {
-                ObjectHolder holder;
-                auto l = ptr_l->GetValue();
-                auto r = ptr_r->GetValue();
-                runtime::Number n(l / r);
-                holder = holder.Own(std::move(n));
-                return holder;
-            }
-            else {
-                throw runtime_error("");
-            }
-        }
-        else {
-            throw runtime_error("");
+        if (ObjectHolder result; TryNumericOperation<CheckedDivide>(lhs, rhs, Divide, DivideFloat, &result)) {
+            return result;
         }
+        throw runtime_error("");
     }
 
     ObjectHolder Compound::Execute(Closure& closure, Context& context) {
         for (size_t i = 0; i < compounds_.size();i++) {
-            compounds_[i].get()->Execute(closure, context);
+            ObjectHolder result = compounds_[i].get()->Execute(closure, context);
+            if (IsSignal(result)) {
+                return result;
+            }
        }
         return {};
     }
 
     ObjectHolder Return::Execute(Closure& closure, Context& context) {
-        ObjectHolder holder = statement_.get()->Execute(closure, context);
-        if (holder.TryAs<runtime::String>()) {
-            throw runtime_error(holder.TryAs<runtime::String>()->GetValue());
-        }
-        if (holder.TryAs<runtime::Number>()) {
-            auto a = holder.TryAs<runtime::Number>()->GetValue();
-            throw runtime_error(std::to_string(a));
-        }
-        return {};
+        return_value = statement_->Execute(closure, context);
+        return RETURN_SIGNAL;
     }
 
     ClassDefinition::ClassDefinition(ObjectHolder cls) : cls_(cls) {
     }
 
     ObjectHolder ClassDefinition::Execute(Closure& closure, Context& context) {
-        closure[cls_.TryAs<runtime::Class>()->GetName()] = cls_;
-        return closure[cls_.TryAs<runtime::Class>()->GetName()];
+        return runtime::AssignVariable(closure, cls_.TryAs<runtime::Class>()->GetName(), cls_);
     }
 
     FieldAssignment::FieldAssignment(VariableValue object, std::string field_name,
@@ -254,7 +610,39 @@ namespace ast {
     }
 
     ObjectHolder FieldAssignment::Execute(Closure& closure, Context& context) {
-        return object_.Execute(closure, context).TryAs<runtime::ClassInstance>()->Fields()[field_name_] = rv_->Execute(closure, context);
+        //    ,     
+        ObjectHolder value = rv_->Execute(closure, context);
+        ObjectHolder object = object_.Execute(closure, context);
+        return object.TryAs<runtime::ClassInstance>()->SetField(field_name_, std::move(value));
+    }
+
+    Index::Index(std::unique_ptr<Statement> object, std::unique_ptr<Statement> index)
+        : object_(std::move(object)), index_(std::move(index)) {
+    }
+
+    ObjectHolder Index::Execute(Closure& closure, Context& context) {
+        ObjectHolder object = object_->Execute(closure, context);
+        ObjectHolder index = index_->Execute(closure, context);
+        if (auto* dict = object.TryAs<runtime::Dict>()) {
+            return dict->Get(index, context);
+        }
+        return AsList(object).GetItem(AsIndex(index));
+    }
+
+    IndexAssignment::IndexAssignment(std::unique_ptr<Statement> object, std::unique_ptr<Statement> index,
+        std::unique_ptr<Statement> rv) : object_(std::move(object)), index_(std::move(index)), rv_(std::move(rv)) {
+    }
+
+    ObjectHolder IndexAssignment::Execute(Closure& closure, Context& context) {
+        ObjectHolder value = rv_->Execute(closure, context);
+        ObjectHolder object = object_->Execute(closure, context);
+        ObjectHolder index = index_->Execute(closure, context);
+        if (auto* dict = object.TryAs<runtime::Dict>()) {
+            dict->Set(std::move(index), value, context);
+            return value;
+        }
+        AsList(object).SetItem(AsIndex(index), value);
+        return value;
     }
 
     IfElse::IfElse(std::unique_ptr<Statement> condition, std::unique_ptr<Statement> if_body,
@@ -262,15 +650,86 @@ namespace ast {
     }
 
     ObjectHolder IfElse::Execute(Closure& closure, Context& context) {
+        if (Statement* branch = SelectBranch(closure, context)) {
+            return branch->Execute(closure, context);
+        }
+        return {};
+    }
+
+    Statement* IfElse::SelectBranch(Closure& closure, Context& context) const {
         if (runtime::IsTrue(condition_.get()->Execute(closure, context))) {
-            return if_body_.get()->Execute(closure, context);
+            return if_body_.get();
         }
-        else {
-            if (else_body_.get() != nullptr) {
-                return else_body_.get()->Execute(closure, context);
-            }
+        return else_body_.get();
+    }
+
+    Loop::Loop(std::unique_ptr<Statement> body)
+        : body_(std::move(body)) {
+    }
+
+    While::While(std::unique_ptr<Statement> condition, std::unique_ptr<Statement> body)
+        : Loop(std::move(body)), condition_(std::move(condition)) {
+    }
+
+    ObjectHolder While::Execute(Closure& closure, Context& context) {
+        WhileIteration iteration(*condition_);
+        return RunLoop(iteration, *body_, closure, context);
+    }
+
+    unique_ptr<Loop::Iteration> While::Start([[maybe_unused]] Closure& closure,
+        [[maybe_unused]] Context& context) const {
+        return make_unique<WhileIteration>(*condition_);
+    }
+
+    ForRange::ForRange(std::string var, std::unique_ptr<Statement> start, std::unique_ptr<Statement> stop,
+        std::unique_ptr<Statement> step, std::unique_ptr<Statement> body)
+        : Loop(std::move(body)), var_(std::move(var)), start_(std::move(start)), stop_(std::move(stop))
+        , step_(std::move(step)) {
+    }
+
+    ObjectHolder ForRange::Execute(Closure& closure, Context& context) {
+        RangeIteration iteration(closure, context, var_, start_.get(), *stop_, step_.get());
+        return RunLoop(iteration, *body_, closure, context);
+    }
+
+    unique_ptr<Loop::Iteration> ForRange::Start(Closure& closure, Context& context) const {
+        return make_unique<RangeIteration>(closure, context, var_, start_.get(), *stop_, step_.get());
+    }
+
+    ForEach::ForEach(std::string var, std::unique_ptr<Statement> iterable, std::unique_ptr<Statement> body)
+        : Loop(std::move(body)), var_(std::move(var)), iterable_(std::move(iterable)) {
+    }
+
+    ObjectHolder ForEach::Execute(Closure& closure, Context& context) {
+        ObjectHolder iterable = iterable_->Execute(closure, context);
+        if (iterable.TryAs<runtime::List>() != nullptr) {
+            ListIteration iteration(closure, var_, std::move(iterable));
+            return RunLoop(iteration, *body_, closure, context);
         }
-        return {};
+        if (iterable.TryAs<runtime::Dict>() != nullptr) {
+            DictIteration iteration(closure, var_, std::move(iterable));
+            return RunLoop(iteration, *body_, closure, context);
+        }
+        throw runtime_error("");
+    }
+
+    unique_ptr<Loop::Iteration> ForEach::Start(Closure& closure, Context& context) const {
+        ObjectHolder iterable = iterable_->Execute(closure, context);
+        if (iterable.TryAs<runtime::List>() != nullptr) {
+            return make_unique<ListIteration>(closure, var_, std::move(iterable));
+        }
+        if (iterable.TryAs<runtime::Dict>() != nullptr) {
+            return make_unique<DictIteration>(closure, var_, std::move(iterable));
+        }
+        throw runtime_error("");
+    }
+
+    ObjectHolder Break::Execute([[maybe_unused]] Closure& closure, [[maybe_unused]] Context& context) {
+        return BREAK_SIGNAL;
+    }
+
+    ObjectHolder Continue::Execute([[maybe_unused]] Closure& closure, [[maybe_unused]] Context& context) {
+        return CONTINUE_SIGNAL;
     }
 
     ObjectHolder Or::Execute(Closure& closure, Context& context) {
@@ -326,41 +785,69 @@ namespace ast {
         return holder;
     }
 
-    NewInstance::NewInstance(const runtime::Class& class_, std::vector<std::unique_ptr<Statement>> args) : new_instance_(class_), args_(std::move(args)) {
+    NewInstance::NewInstance(const runtime::Class& class_, std::vector<std::unique_ptr<Statement>> args) : class_(class_), args_(std::move(args)) {
     }
 
-    NewInstance::NewInstance(const runtime::Class& class_) : new_instance_(class_) {
+    NewInstance::NewInstance(const runtime::Class& class_) : class_(class_) {
     }
 
     ObjectHolder NewInstance::Execute(Closure& closure, Context& context) {
-        if (new_instance_.HasMethod(INIT_METHOD, args_.size())) {
-            std::vector<runtime::ObjectHolder> args;
+        context.ChargeFuel();
+        ObjectHolder holder = ObjectHolder::Own(runtime::ClassInstance(class_));
+        if (auto* collector = context.GetCycleCollector()) {
+            collector->Track(holder);
+        }
+        auto* instance = holder.TryAs<runtime::ClassInstance>();
+        if (instance->HasMethod(INIT_METHOD, args_.size())) {
+            runtime::FrameStack::ArgumentFrame args(runtime::FrameStack::ForThread());
             for (const auto& arg : args_) {
-                args.push_back(arg.get()->Execute(closure, context));
+                args.Push(arg.get()->Execute(closure, context));
             }
-            new_instance_.Call(INIT_METHOD, args, context);
-            return ObjectHolder::Share(new_instance_);
+            instance->Call(INIT_METHOD, args.Get(), context);
         }
-        else {
-            return ObjectHolder::Share(new_instance_);
+        return holder;
+    }
+
+    NewList::NewList(std::vector<std::unique_ptr<Statement>> items) : items_(std::move(items)) {
+    }
+
+    ObjectHolder NewList::Execute(Closure& closure, Context& context) {
+        context.ChargeFuel();
+        ObjectHolder holder = ObjectHolder::Own(runtime::List());
+        if (auto* collector = context.GetCycleCollector()) {
+            collector->Track(holder);
         }
-        return {};
+        auto* list = holder.TryAs<runtime::List>();
+        for (const auto& item : items_) {
+            list->Append(item->Execute(closure, context));
+        }
+        return holder;
+    }
+
+    NewDict::NewDict(std::vector<std::pair<std::unique_ptr<Statement>, std::unique_ptr<Statement>>> items)
+        : items_(std::move(items)) {
+    }
+
+    ObjectHolder NewDict::Execute(Closure& closure, Context& context) {
+        context.ChargeFuel();
+        ObjectHolder holder = ObjectHolder::Own(runtime::Dict());
+        if (auto* collector = context.GetCycleCollector()) {
+            collector->Track(holder);
+        }
+        auto* dict = holder.TryAs<runtime::Dict>();
+        for (const auto& [key, value] : items_) {
+            ObjectHolder key_value = key->Execute(closure, context);
+            dict->Set(std::move(key_value), value->Execute(closure, context), context);
+        }
+        return holder;
     }
 
     MethodBody::MethodBody(std::unique_ptr<Statement>&& body) : body_(std::move(body)) {
     }
 
     ObjectHolder MethodBody::Execute(Closure& closure, Context& context) {
-        try {
-            body_.get()->Execute(closure, context);
-        }
-        catch (runtime_error const& e)
-        {
-            auto a = e.what();
-            std::string s(a);
-            ObjectHolder holder;
-            holder = holder.Own((runtime::String(s)));
-            return holder;
+        if (body_->Execute(closure, context).Get() == &return_signal) {
+            return std::move(return_value);
         }
         return {};
     }
@@ -13,19 +13,22 @@ namespace ast {
     class ValueStatement : public Statement {
     public:
         explicit ValueStatement(T v)
-            : value_(std::move(v)) {
+            : value_(runtime::ObjectHolder::Own(std::move(v))) {
         }
 
+        //    ,      , 
+        //   (,  str)    
         runtime::ObjectHolder Execute(runtime::Closure& closure,
             runtime::Context& context) override {
-            return runtime::ObjectHolder::Share(value_);
+            return value_;
         }
 
     private:
-        T value_;
+        runtime::ObjectHolder value_;
     };
 
     using NumericConst = ValueStatement<runtime::Number>;
+    using FloatConst = ValueStatement<runtime::Float>;
     using StringConst = ValueStatement<runtime::String>;
     using BoolConst = ValueStatement<runtime::Bool>;
 
@@ -76,6 +79,34 @@ namespace ast {
 
 
 
+    //       object[index]
+    class Index : public Statement {
+    public:
+        Index(std::unique_ptr<Statement> object, std::unique_ptr<Statement> index);
+
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+    private:
+        std::unique_ptr<Statement> object_;
+        std::unique_ptr<Statement> index_;
+    };
+
+
+
+    //       object[index]   rv
+    class IndexAssignment : public Statement {
+    public:
+        IndexAssignment(std::unique_ptr<Statement> object, std::unique_ptr<Statement> index,
+            std::unique_ptr<Statement> rv);
+
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+    private:
+        std::unique_ptr<Statement> object_;
+        std::unique_ptr<Statement> index_;
+        std::unique_ptr<Statement> rv_;
+    };
+
+
+
     //  None
     class None : public Statement {
     public:
@@ -98,8 +129,7 @@ namespace ast {
         //   print     name
         static std::unique_ptr<Print> Variable(const std::string& name);
 
-        //     print     ,  
-        // context.GetOutputStream()
+        //    Object::Render,      context.Write()
         runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
     private:
         std::unique_ptr<Statement> argument_;
@@ -140,15 +170,37 @@ namespace ast {
     public:
         explicit NewInstance(const runtime::Class& class_);
         NewInstance(const runtime::Class& class_, std::vector<std::unique_ptr<Statement>> args);
-        //  ,    ClassInstance
+        //  ,     ClassInstance,   
         runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
     private:
-        runtime::ClassInstance new_instance_;
+        const runtime::Class& class_;
         std::vector<std::unique_ptr<Statement>> args_;
     };
 
 
 
+    //      items: [1, 2, x]
+    class NewList : public Statement {
+    public:
+        explicit NewList(std::vector<std::unique_ptr<Statement>> items);
+
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+    private:
+        std::vector<std::unique_ptr<Statement>> items_;
+    };
+
+    //      : : {'a': 1, x: y}
+    class NewDict : public Statement {
+    public:
+        explicit NewDict(std::vector<std::pair<std::unique_ptr<Statement>, std::unique_ptr<Statement>>> items);
+
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+    private:
+        std::vector<std::pair<std::unique_ptr<Statement>, std::unique_ptr<Statement>>> items_;
+    };
+
+
+
     //     
     class UnaryOperation : public Statement {
     public:
@@ -166,6 +218,34 @@ namespace ast {
         runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
     };
 
+    //  len,   ,   
+    class Length : public UnaryOperation {
+    public:
+        using UnaryOperation::UnaryOperation;
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+    };
+
+    //  sum,    
+    class Sum : public UnaryOperation {
+    public:
+        using UnaryOperation::UnaryOperation;
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+    };
+
+    //  min,    
+    class Minimum : public UnaryOperation {
+    public:
+        using UnaryOperation::UnaryOperation;
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+    };
+
+    //  max,    
+    class Maximum : public UnaryOperation {
+    public:
+        using UnaryOperation::UnaryOperation;
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+    };
+
 
 
     //       lhs  rhs
@@ -279,8 +359,17 @@ namespace ast {
         void AddStatement(std::unique_ptr<Statement> stmt) {
             compounds_.push_back(std::move(stmt));
         }
-        //    .  None
+        //    .  None,   
+        //   break, continue  return -   (. Break),   
         runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+
+        //       (. executor::ScriptRun)
+        [[nodiscard]] size_t GetStatementCount() const {
+            return compounds_.size();
+        }
+        [[nodiscard]] Statement& GetStatement(size_t index) const {
+            return *compounds_[index];
+        }
     private:
         std::vector<std::unique_ptr<Statement>> compounds_;
     };
@@ -294,7 +383,7 @@ namespace ast {
 
         //  ,    body.
         //   body    return,   return
-        //     None
+        //     None.   body  
         runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
     private:
         std::unique_ptr<Statement> body_;
@@ -311,6 +400,7 @@ namespace ast {
 
         //    .    return ,
         //     ,      statement.
+        //  , ,    Break,    MethodBody
         runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
     private:
         std::unique_ptr<Statement> statement_;
@@ -341,12 +431,100 @@ namespace ast {
             std::unique_ptr<Statement> else_body);
 
         runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+
+        //     ,   ,  nullptr
+        [[nodiscard]] Statement* SelectBranch(runtime::Closure& closure, runtime::Context& context) const;
     private:
         std::unique_ptr<Statement> condition_;
         std::unique_ptr<Statement> if_body_;
         std::unique_ptr<Statement> else_body_;
     };
 
+    // .   ,      (. executor::ScriptRun)
+    class Loop : public Statement {
+    public:
+        //   
+        class Iteration {
+        public:
+            virtual ~Iteration() = default;
+
+            //   :      .
+            //  false,    
+            virtual bool Next(runtime::Closure& closure, runtime::Context& context) = 0;
+        };
+
+        //  :   range   
+        [[nodiscard]] virtual std::unique_ptr<Iteration> Start(runtime::Closure& closure,
+            runtime::Context& context) const = 0;
+
+        [[nodiscard]] Statement& GetBody() const {
+            return *body_;
+        }
+
+    protected:
+        explicit Loop(std::unique_ptr<Statement> body);
+
+        std::unique_ptr<Statement> body_;
+    };
+
+    //  while <condition>: <body>
+    class While : public Loop {
+    public:
+        While(std::unique_ptr<Statement> condition, std::unique_ptr<Statement> body);
+
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+        [[nodiscard]] std::unique_ptr<Iteration> Start(runtime::Closure& closure,
+            runtime::Context& context) const override;
+    private:
+        std::unique_ptr<Statement> condition_;
+    };
+
+    //  for <var> in range(<start>, <stop>, <step>): <body>.      
+    //   ,   var       
+    class ForRange : public Loop {
+    public:
+        //  start  step    nullptr,    0  1
+        ForRange(std::string var, std::unique_ptr<Statement> start, std::unique_ptr<Statement> stop,
+            std::unique_ptr<Statement> step, std::unique_ptr<Statement> body);
+
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+        [[nodiscard]] std::unique_ptr<Iteration> Start(runtime::Closure& closure,
+            runtime::Context& context) const override;
+    private:
+        std::string var_;
+        std::unique_ptr<Statement> start_;
+        std::unique_ptr<Statement> stop_;
+        std::unique_ptr<Statement> step_;
+    };
+
+    //  for <var> in <iterable>: <body>      .
+    // ,      ,  ,     
+    //     
+    class ForEach : public Loop {
+    public:
+        ForEach(std::string var, std::unique_ptr<Statement> iterable, std::unique_ptr<Statement> body);
+
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+        [[nodiscard]] std::unique_ptr<Iteration> Start(runtime::Closure& closure,
+            runtime::Context& context) const override;
+    private:
+        std::string var_;
+        std::unique_ptr<Statement> iterable_;
+    };
+
+    //  break.  -,     ,
+    //      .  break  continue   
+    class Break : public Statement {
+    public:
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+    };
+
+    //  continue.  -,   Break
+    class Continue : public Statement {
+    public:
+        runtime::ObjectHolder Execute(runtime::Closure& closure, runtime::Context& context) override;
+    };
+
 
 
     //  
@@ -0,0 +1,75 @@
+#include "lexer.h"
+#include "parse.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    //         x
+    string MakeProgram(const string& initial, int lines) {
+        string program = "x = "s + initial + "\n"s;
+        for (int i = 0; i < lines; ++i) {
+            const string n = to_string(i % 7 + 1);
+            program += "x = x + "s + n + " * 3 - "s + n + " / 2 - 2\n"s;
+        }
+        return program;
+    }
+
+    //     x     
+    string MakeRepeatedProgram(const string& line, int lines) {
+        string program = "x = 0\n"s;
+        for (int i = 0; i < lines; ++i) {
+            program += line + "\n"s;
+        }
+        return program;
+    }
+
+    //        
+    double MeasureLine(const string& text, int lines) {
+        const int runs = 50;
+        istringstream input(text);
+        parse::Lexer lexer(input);
+        auto program = ParseProgram(lexer);
+
+        const auto start = chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i) {
+            ostringstream output;
+            runtime::SimpleContext context{ output };
+            runtime::Closure closure;
+            program->Execute(closure, context);
+        }
+        const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+        return elapsed.count() / (runs * lines);
+    }
+
+    void MeasureArithmetic(ostream& out, const string& title, const string& initial) {
+        const int lines = 10000;
+        const int operations = 4;
+        const double ns = MeasureLine(MakeProgram(initial, lines), lines) / operations;
+        out << fixed << setprecision(1);
+        out << title << setw(10) << ns << " ns/op"s << endl;
+    }
+
+}  // namespace
+
+//    , ,    64 ,  Float
+void RunArithmeticBenchmark(ostream& out) {
+    MeasureArithmetic(out, "small integers       "s, "0"s);
+    MeasureArithmetic(out, "near 2^31            "s, "2147483000"s);
+    //     ,         BigInteger
+    MeasureArithmetic(out, "beyond 2^64          "s, "4000000000 * 4000000000 * 4000000000"s);
+    MeasureArithmetic(out, "floats with integers "s, "0.5"s);
+
+    //   :      Float
+    const int lines = 10000;
+    out << "discounted price, scaled integers"s << setw(10)
+        << MeasureLine(MakeRepeatedProgram("x = x + 1999 * 95 / 100"s, lines), lines) << " ns/line"s << endl;
+    out << "discounted price, floats         "s << setw(10)
+        << MeasureLine(MakeRepeatedProgram("x = x + 19.99 * 0.95"s, lines), lines) << " ns/line"s << endl;
+}
@@ -0,0 +1,75 @@
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+void RunLexerBenchmark(ostream& out);
+void RunParseBenchmark(ostream& out);
+void RunExecutorBenchmark(ostream& out);
+void RunOutputBenchmark(ostream& out);
+void RunSchedulerBenchmark(ostream& out);
+void RunSnapshotBenchmark(ostream& out);
+void RunServerBenchmark(ostream& out);
+void RunCycleBenchmark(ostream& out);
+void RunValuesBenchmark(ostream& out);
+void RunCallsBenchmark(ostream& out);
+void RunInstancesBenchmark(ostream& out);
+void RunFieldsBenchmark(ostream& out);
+void RunArithmeticBenchmark(ostream& out);
+void RunListsBenchmark(ostream& out);
+void RunDictsBenchmark(ostream& out);
+void RunLoopsBenchmark(ostream& out);
+
+namespace {
+
+    struct Benchmark {
+        string name;
+        function<void(ostream&)> run;
+    };
+
+    const vector<Benchmark>& Benchmarks() {
+        static const vector<Benchmark> benchmarks = {
+            {"lexer"s, RunLexerBenchmark},
+            {"parse"s, RunParseBenchmark},
+            {"executor"s, RunExecutorBenchmark},
+            {"output"s, RunOutputBenchmark},
+            {"scheduler"s, RunSchedulerBenchmark},
+            {"snapshot"s, RunSnapshotBenchmark},
+            {"server"s, RunServerBenchmark},
+            {"cycles"s, RunCycleBenchmark},
+            {"values"s, RunValuesBenchmark},
+            {"calls"s, RunCallsBenchmark},
+            {"instances"s, RunInstancesBenchmark},
+            {"fields"s, RunFieldsBenchmark},
+            {"arithmetic"s, RunArithmeticBenchmark},
+            {"lists"s, RunListsBenchmark},
+            {"dicts"s, RunDictsBenchmark},
+            {"loops"s, RunLoopsBenchmark},
+        };
+        return benchmarks;
+    }
+
+}  // namespace
+
+//     ,  -    
+int main(int argc, char** argv) {
+    try {
+        for (const auto& benchmark : Benchmarks()) {
+            bool selected = argc < 2;
+            for (int i = 1; i < argc; ++i) {
+                selected = selected || benchmark.name == argv[i];
+            }
+            if (selected) {
+                cout << "== "s << benchmark.name << " =="s << endl;
+                benchmark.run(cout);
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
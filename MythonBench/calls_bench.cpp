@@ -0,0 +1,64 @@
+#include "lexer.h"
+#include "parse.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    //   -  ,        .
+    //  add   ,    
+    string MakeProgram(int calls, const string& add_body) {
+        string program = R"(
+class Counter:
+  def __init__():
+    self.value = 0
+    self.last = 0
+
+  def add(a, b):
+    )"s + add_body + R"(
+
+  def step(n):
+    self.add(n, 1)
+
+c = Counter()
+)"s;
+        for (int i = 0; i < calls; ++i) {
+            program += "c.step("s + to_string(i % 10) + ")\n"s;
+        }
+        return program;
+    }
+
+    void MeasureCalls(ostream& out, const string& title, const string& add_body) {
+        const int calls = 10000;
+        const int runs = 50;
+        istringstream input(MakeProgram(calls, add_body));
+        parse::Lexer lexer(input);
+        auto program = ParseProgram(lexer);
+
+        const auto start = chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i) {
+            ostringstream output;
+            runtime::SimpleContext context{ output };
+            runtime::Closure closure;
+            program->Execute(closure, context);
+        }
+        const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+        out << fixed << setprecision(1);
+        out << runs * calls * 2 << " method calls"s << title << setw(10) << elapsed.count() / (runs * calls * 2.0)
+            << " ns/call"s << endl;
+    }
+
+}  // namespace
+
+//   :  self,  ,  Closure
+void RunCallsBenchmark(ostream& out) {
+    MeasureCalls(out, "                  "s, "self.value = self.value + a - b"s);
+    //    ,     
+    MeasureCalls(out, ", storing argument"s, "self.last = a"s);
+}
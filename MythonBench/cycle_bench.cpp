@@ -0,0 +1,85 @@
+#include "cycle_collector.h"
+#include "lexer.h"
+#include "parse.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    //   make      
+    string MakeProgram(int calls) {
+        string program = R"(
+class Node:
+  def __init__(value):
+    self.value = value
+
+class Factory:
+  def make(n):
+    a = Node(n)
+    b = Node(n + 1)
+    c = Node(n + 2)
+    a.next = b
+    b.next = c
+    c.next = a
+    self.last = a.value
+
+f = Factory()
+keep = Node(0)
+keep.next = keep
+)"s;
+        for (int i = 0; i < calls; ++i) {
+            program += "f.make("s + to_string(i) + ")\n"s;
+        }
+        return program;
+    }
+
+    double Milliseconds(chrono::steady_clock::duration duration) {
+        return chrono::duration<double, milli>(duration).count();
+    }
+
+}  // namespace
+
+//          
+void RunCycleBenchmark(ostream& out) {
+    const int calls = 20000;
+    istringstream input(MakeProgram(calls));
+    parse::Lexer lexer(input);
+    auto program = ParseProgram(lexer);
+    out << calls * 3 << " objects in unreachable cycles"s << endl;
+    out << fixed << setprecision(3);
+
+    {
+        ostringstream output;
+        runtime::SimpleContext context{ output };
+        runtime::Closure closure;
+        const auto start = chrono::steady_clock::now();
+        program->Execute(closure, context);
+        out << "no collector        "s << setw(10) << Milliseconds(chrono::steady_clock::now() - start)
+            << " ms, cycles leak"s << endl;
+    }
+
+    for (size_t threshold : { 1000, 10000, 100000 }) {
+        ostringstream output;
+        runtime::SimpleContext context{ output };
+        runtime::CycleCollector collector(threshold);
+        context.SetCycleCollector(&collector);
+        runtime::Closure closure;
+        const auto start = chrono::steady_clock::now();
+        program->Execute(closure, context);
+        collector.Collect();
+        const auto elapsed = chrono::steady_clock::now() - start;
+
+        const auto& stats = collector.GetStats();
+        out << "threshold "s << setw(6) << threshold << "    "s << setw(10) << Milliseconds(elapsed) << " ms, "s
+            << stats.collections << " collections, "s
+            << stats.reclaimed_objects << " objects / "s << stats.reclaimed_bytes / 1024 << " KiB reclaimed, "s
+            << "pause max "s << Milliseconds(stats.max_pause) << " ms, total "s << Milliseconds(stats.total_pause)
+            << " ms"s << endl;
+    }
+}
@@ -0,0 +1,132 @@
+#include "dict.h"
+#include "lexer.h"
+#include "memory_account.h"
+#include "parse.h"
+#include "runtime.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+    constexpr int LOOKUPS = 2000000;
+
+    unique_ptr<runtime::Executable> Parse(const string& source) {
+        istringstream input(source);
+        parse::Lexer lexer(input);
+        return ParseProgram(lexer);
+    }
+
+    //  :       key123
+    vector<runtime::ObjectHolder> MakeKeys(int count, bool strings, uint64_t seed) {
+        mt19937_64 random(seed);
+        vector<runtime::ObjectHolder> keys;
+        keys.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            const int64_t value = static_cast<int64_t>(random() >> 1);
+            keys.push_back(strings ? runtime::ObjectHolder::Own(runtime::String("key"s + to_string(value)))
+                                   : runtime::ObjectHolder::Own(runtime::Number(value)));
+        }
+        return keys;
+    }
+
+    //      ,       
+    vector<runtime::ObjectHolder> MakeProbes(const vector<runtime::ObjectHolder>& keys) {
+        mt19937_64 random(7);
+        vector<runtime::ObjectHolder> probes;
+        probes.reserve(LOOKUPS);
+        uniform_int_distribution<size_t> index(0, keys.size() - 1);
+        for (int i = 0; i < LOOKUPS; ++i) {
+            probes.push_back(keys[index(random)]);
+        }
+        return probes;
+    }
+
+    template <typename Lookup>
+    double MeasureLookups(const vector<runtime::ObjectHolder>& probes, Lookup lookup) {
+        size_t found = 0;
+        const auto start = chrono::steady_clock::now();
+        for (const auto& probe : probes) {
+            found += lookup(probe) ? 1 : 0;
+        }
+        const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+        if (found == static_cast<size_t>(-1)) {
+            cout << found;
+        }
+        return elapsed.count() / static_cast<double>(probes.size());
+    }
+
+    //      std::unordered_map     
+    void MeasureSize(ostream& out, int size) {
+        ostringstream output;
+        runtime::SimpleContext context{ output };
+
+        const auto ints = MakeKeys(size, false, 42);
+        const auto strings = MakeKeys(size, true, 43);
+        runtime::Dict int_dict;
+        runtime::Dict string_dict;
+        unordered_map<int64_t, runtime::ObjectHolder> baseline;
+        for (int i = 0; i < size; ++i) {
+            int_dict.Set(ints[i], runtime::ObjectHolder::None(), context);
+            string_dict.Set(strings[i], runtime::ObjectHolder::None(), context);
+            baseline.emplace(ints[i].TryAs<runtime::Number>()->GetValue(), runtime::ObjectHolder::None());
+        }
+
+        const auto int_probes = MakeProbes(ints);
+        const auto miss_probes = MakeProbes(MakeKeys(size, false, 44));
+        const auto string_probes = MakeProbes(strings);
+        const double int_hit = MeasureLookups(int_probes, [&](const runtime::ObjectHolder& key) {
+            return int_dict.Find(key, context) != nullptr;
+        });
+        const double int_miss = MeasureLookups(miss_probes, [&](const runtime::ObjectHolder& key) {
+            return int_dict.Find(key, context) != nullptr;
+        });
+        const double string_hit = MeasureLookups(string_probes, [&](const runtime::ObjectHolder& key) {
+            return string_dict.Find(key, context) != nullptr;
+        });
+        const double baseline_hit = MeasureLookups(int_probes, [&](const runtime::ObjectHolder& key) {
+            return baseline.count(key.TryAs<runtime::Number>()->GetValue()) != 0;
+        });
+
+        out << "size "s << setw(7) << size << ": int hit "s << setw(6) << int_hit << " ns, int miss "s << setw(6)
+            << int_miss << " ns, str hit "s << setw(6) << string_hit << " ns, unordered_map int hit "s << setw(6)
+            << baseline_hit << " ns, index "s << setw(5)
+            << static_cast<double>(int_dict.GetHeapBytes()) / size << " bytes/entry"s << endl;
+    }
+
+    //   d[k]  ,     
+    double MeasureScriptLookup() {
+        const int runs = 1000000;
+        ostringstream output;
+        runtime::SimpleContext context{ output };
+        runtime::Closure closure;
+        Parse("d = {'alpha': 1, 'beta': 2, 'gamma': 3, 7: 4}\nk = 'gamma'\n"s)->Execute(closure, context);
+        const auto program = Parse("r = d[k]\n"s);
+        const auto start = chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i) {
+            program->Execute(closure, context);
+        }
+        const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+        return elapsed.count() / runs;
+    }
+
+}  // namespace
+
+//            
+void RunDictsBenchmark(ostream& out) {
+    out << fixed << setprecision(2);
+    for (const int size : { 16, 1024, 65536, 1048576 }) {
+        MeasureSize(out, size);
+    }
+    out << "script r = d[k]: "s << MeasureScriptLookup() << " ns"s << endl;
+}
@@ -0,0 +1,65 @@
+#include "executor.h"
+#include "lexer.h"
+#include "parse.h"
+#include "statement.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    const string PROGRAM = R"(
+class Fib:
+  def calc(n):
+    if n < 2:
+      self.result = self.result + n
+    else:
+      self.calc(n - 1)
+      self.calc(n - 2)
+
+f = Fib()
+f.result = 0
+f.calc(depth)
+print 'fib', depth, '=', f.result
+)"s;
+
+    double Microseconds(executor::Clock::duration d) {
+        return chrono::duration<double, micro>(d).count();
+    }
+
+}  // namespace
+
+//          1-16 
+void RunExecutorBenchmark(ostream& out) {
+    istringstream input(PROGRAM);
+    parse::Lexer lexer(input);
+    shared_ptr<runtime::Executable> program = ParseProgram(lexer);
+
+    const size_t job_count = 2000;
+    out << job_count << " jobs, fib(12) each"s << endl;
+    out << fixed << setprecision(1);
+
+    for (size_t threads : { 1, 2, 4, 8, 16 }) {
+        vector<ostringstream> outputs(job_count);
+        vector<executor::Job> jobs(job_count);
+        for (size_t i = 0; i < job_count; ++i) {
+            jobs[i].program = program;
+            jobs[i].input["depth"s] = runtime::ObjectHolder::Own(runtime::Number(12));
+            jobs[i].output = &outputs[i];
+        }
+
+        const auto report = executor::BatchExecutor(threads).Run(jobs);
+        if (report.FailedCount() != 0) {
+            throw runtime_error("Executor benchmark job failed: "s + report.jobs.front().error);
+        }
+        out << "threads "s << setw(2) << threads << "  "s << setw(9) << report.Throughput() << " jobs/s"s
+            << "  p50 "s << setw(9) << Microseconds(report.LatencyPercentile(0.5)) << " us"s
+            << "  p99 "s << setw(9) << Microseconds(report.LatencyPercentile(0.99)) << " us"s
+            << "  steals "s << report.steals << endl;
+    }
+}
@@ -0,0 +1,84 @@
+#include "lexer.h"
+#include "memory_account.h"
+#include "parse.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    //    next   field_count - 1 
+    string MakeClass(int field_count) {
+        string program = "class Item:\n  def __init__(next):\n    self.next = next\n"s;
+        for (int i = 1; i < field_count; ++i) {
+            program += "    self.f"s + to_string(i) + " = "s + to_string(i) + "\n"s;
+        }
+        return program + "\n"s;
+    }
+
+    unique_ptr<runtime::Executable> Parse(const string& source) {
+        istringstream input(source);
+        parse::Lexer lexer(input);
+        return ParseProgram(lexer);
+    }
+
+    //        MemoryAccount
+    double MeasureBytesPerInstance(int field_count) {
+        const int count = 1000;
+        string source = MakeClass(field_count) + "head = None\n"s;
+        for (int i = 0; i < count; ++i) {
+            source += "head = Item(head)\n"s;
+        }
+        const auto program = Parse(source);
+
+        auto account = make_shared<runtime::MemoryAccount>();
+        const runtime::MemoryAccount::Scope scope(account);
+        ostringstream output;
+        runtime::SimpleContext context{ output };
+        runtime::Closure closure;
+        program->Execute(closure, context);
+        const auto stats = account->GetStats();
+        const size_t bytes = stats[runtime::MemoryKind::Instance].live_bytes + stats[runtime::MemoryKind::Closure].live_bytes
+            - 2 * runtime::GetClosureEntryBytes("head"s) - runtime::GetClosureEntryBytes("Item"s);
+        return static_cast<double>(bytes) / count;
+    }
+
+    //   ,       
+    double MeasureAccess(int field_count, bool write) {
+        const int lines = 10000;
+        const int runs = 30;
+        const string field = "item.f"s + to_string(field_count - 1);
+        string source = MakeClass(field_count) + "item = Item(None)\nv = 0\n"s;
+        for (int i = 0; i < lines; ++i) {
+            source += write ? field + " = v\n"s : "v = "s + field + "\n"s;
+        }
+        const auto program = Parse(source);
+
+        const auto start = chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i) {
+            ostringstream output;
+            runtime::SimpleContext context{ output };
+            runtime::Closure closure;
+            program->Execute(closure, context);
+        }
+        const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+        return elapsed.count() / (static_cast<double>(lines) * runs);
+    }
+
+}  // namespace
+
+//            
+void RunFieldsBenchmark(ostream& out) {
+    out << fixed << setprecision(1);
+    for (const int field_count : { 2, 6, 12 }) {
+        out << setw(2) << field_count << " fields: "s << setw(8) << MeasureBytesPerInstance(field_count) << " bytes/instance, read "s
+            << setw(6) << MeasureAccess(field_count, false) << " ns, write "s << setw(6) << MeasureAccess(field_count, true)
+            << " ns"s << endl;
+    }
+}
@@ -0,0 +1,72 @@
+#include "lexer.h"
+#include "parse.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    const string CLASSES = R"(
+class Node:
+  def __init__(next):
+    self.next = next
+
+class Tree:
+  def __init__(left, right):
+    self.left = left
+    self.right = right
+
+class Grower:
+  def grow(node, depth):
+    if depth > 0:
+      node.left = Tree(None, None)
+      node.right = Tree(None, None)
+      self.grow(node.left, depth - 1)
+      self.grow(node.right, depth - 1)
+
+)"s;
+
+    //  count    1000 .   ,  head
+    //  ,     
+    string MakeListProgram(int count) {
+        string program = CLASSES;
+        for (int i = 0; i < count; ++i) {
+            program += i % 1000 == 0 ? "head = Node(None)\n"s : "head = Node(head)\n"s;
+        }
+        return program;
+    }
+
+    //      depth
+    string MakeTreeProgram(int depth) {
+        return CLASSES + "root = Tree(None, None)\ngrower = Grower()\ngrower.grow(root, "s + to_string(depth) + ")\n"s;
+    }
+
+    void Measure(ostream& out, const string& title, const string& source, int objects, int runs) {
+        istringstream input(source);
+        parse::Lexer lexer(input);
+        auto program = ParseProgram(lexer);
+
+        const auto start = chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i) {
+            ostringstream output;
+            runtime::SimpleContext context{ output };
+            runtime::Closure closure;
+            program->Execute(closure, context);
+        }
+        const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+        out << fixed << setprecision(1);
+        out << title << setw(10) << elapsed.count() / (static_cast<double>(objects) * runs) << " ns/object"s << endl;
+    }
+
+}  // namespace
+
+//     :     
+void RunInstancesBenchmark(ostream& out) {
+    Measure(out, "linked list of 10000 nodes      "s, MakeListProgram(10000), 10000, 30);
+    Measure(out, "binary tree of depth 14         "s, MakeTreeProgram(14), (1 << 15) - 1, 10);
+}
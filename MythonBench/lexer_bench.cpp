@@ -0,0 +1,88 @@
+#include "parallel_lexer.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+    const string PROGRAM_PART = R"--(
+class Shape{0}:
+  def __init__(width, height):
+    self.width = width
+    self.height = height
+
+  def area():
+    return self.width * self.height
+
+  def __str__():
+    if self.width == self.height:
+      return 'Square(' + str(self.width) + ')'
+    else:
+      return "Rect(" + str(self.width) + 'x' + str(self.height) + ")"
+
+# shape {0}
+s{0} = Shape{0}(10, 20)
+print s{0}, s{0}.area() + 1 - 2 * 3 / 4
+)--"s;
+
+    string MakeProgram(size_t min_size) {
+        string program;
+        for (size_t i = 0; program.size() < min_size; ++i) {
+            string part = PROGRAM_PART;
+            const string id = to_string(i);
+            for (size_t pos = part.find("{0}"s); pos != string::npos; pos = part.find("{0}"s, pos)) {
+                part.replace(pos, 3, id);
+            }
+            program += part;
+        }
+        return program;
+    }
+
+    template <typename Func>
+    double MeasureSeconds(Func func, int repeats) {
+        double best = 0;
+        for (int i = 0; i < repeats; ++i) {
+            const auto start = chrono::steady_clock::now();
+            func();
+            const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+            if (i == 0 || elapsed.count() < best) {
+                best = elapsed.count();
+            }
+        }
+        return best;
+    }
+
+}  // namespace
+
+//     TokenizeParallel  1-16 
+void RunLexerBenchmark(ostream& out) {
+    const int repeats = 3;
+    const string program = MakeProgram(8 * 1024 * 1024);
+
+    size_t token_count = 0;
+    const double serial = MeasureSeconds([&]() {
+        istringstream input(program);
+        token_count = parse::Tokenize(input).size();
+    }, repeats);
+
+    out << "source: "s << program.size() / 1024 << " KiB, "s << token_count << " tokens, "s
+        << thread::hardware_concurrency() << " hardware threads"s << endl;
+    out << fixed << setprecision(3);
+    out << "serial      "s << setw(8) << serial * 1000 << " ms"s << endl;
+
+    for (size_t threads : { 1, 2, 4, 8, 12, 16 }) {
+        const double parallel = MeasureSeconds([&]() {
+            if (parse::TokenizeParallel(program, threads).size() != token_count) {
+                throw runtime_error("Parallel lexer produced a different token stream"s);
+            }
+        }, repeats);
+        out << "threads "s << setw(2) << threads << "  "s << setw(8) << parallel * 1000 << " ms, speedup x"s
+            << setprecision(2) << serial / parallel << setprecision(3) << endl;
+    }
+}
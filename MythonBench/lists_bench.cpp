@@ -0,0 +1,100 @@
+#include "lexer.h"
+#include "memory_account.h"
+#include "parse.h"
+#include "runtime.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    constexpr int LIST_SIZE = 100000;
+
+    unique_ptr<runtime::Executable> Parse(const string& source) {
+        istringstream input(source);
+        parse::Lexer lexer(input);
+        return ParseProgram(lexer);
+    }
+
+    //   .          ObjectHolder:
+    //   None         
+    runtime::ObjectHolder MakeList(bool boxed) {
+        mt19937_64 random(42);
+        uniform_int_distribution<int64_t> values(-1000000, 1000000);
+        runtime::ObjectHolder holder = runtime::ObjectHolder::Own(runtime::List());
+        auto& list = *holder.TryAs<runtime::List>();
+        if (boxed) {
+            list.Append(runtime::ObjectHolder::None());
+        }
+        for (int i = 0; i < LIST_SIZE; ++i) {
+            list.Append(runtime::ObjectHolder::Own(runtime::Number(values(random))));
+        }
+        if (boxed) {
+            list.SetItem(0, runtime::ObjectHolder::Own(runtime::Number(0)));
+        }
+        return holder;
+    }
+
+    //    function(xs)     
+    double MeasureFunction(const string& function, bool boxed) {
+        const int runs = 50;
+        const auto program = Parse("r = "s + function + "(xs)\n"s);
+        const runtime::ObjectHolder list = MakeList(boxed);
+
+        ostringstream output;
+        runtime::SimpleContext context{ output };
+        runtime::Closure closure;
+        closure["xs"s] = list;
+        const auto start = chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i) {
+            program->Execute(closure, context);
+        }
+        const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+        return elapsed.count() / (static_cast<double>(LIST_SIZE) * runs);
+    }
+
+    //      ;     
+    double MeasureSort(bool boxed) {
+        const int runs = 10;
+        const auto program = Parse("xs.sort()\n"s);
+        chrono::duration<double, nano> elapsed{};
+        for (int i = 0; i < runs; ++i) {
+            ostringstream output;
+            runtime::SimpleContext context{ output };
+            runtime::Closure closure;
+            closure["xs"s] = MakeList(boxed);
+            const auto start = chrono::steady_clock::now();
+            program->Execute(closure, context);
+            elapsed += chrono::steady_clock::now() - start;
+        }
+        return elapsed.count() / (static_cast<double>(LIST_SIZE) * runs);
+    }
+
+    //        MemoryAccount
+    double MeasureBytesPerItem(bool boxed) {
+        auto account = make_shared<runtime::MemoryAccount>();
+        const runtime::MemoryAccount::Scope scope(account);
+        const runtime::ObjectHolder list = MakeList(boxed);
+        const auto stats = account->GetStats();
+        return static_cast<double>(stats.live_bytes) / LIST_SIZE;
+    }
+
+}  // namespace
+
+//             
+void RunListsBenchmark(ostream& out) {
+    out << fixed << setprecision(2);
+    for (const bool boxed : { false, true }) {
+        out << (boxed ? "boxed:   "s : "unboxed: "s) << setw(6) << MeasureBytesPerItem(boxed) << " bytes/item, sum "s
+            << setw(5) << MeasureFunction("sum"s, boxed) << " ns/item, min "s << setw(5) << MeasureFunction("min"s, boxed)
+            << " ns/item, max "s << setw(5) << MeasureFunction("max"s, boxed) << " ns/item, sort "s << setw(6)
+            << MeasureSort(boxed) << " ns/item"s << endl;
+    }
+}
@@ -0,0 +1,62 @@
+#include "lexer.h"
+#include "parse.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    constexpr int ITERATIONS = 10000000;
+    //   : 10M        
+    constexpr int RECURSION_DEPTH = 1000;
+
+    const string COUNTER_CLASS = R"(
+class Counter:
+  def __init__():
+    self.total = 0
+
+  def count(n):
+    if n > 0:
+      self.total = self.total + n
+      self.count(n - 1)
+
+c = Counter()
+)"s;
+
+    //       
+    double Measure(const string& source) {
+        istringstream input(source);
+        parse::Lexer lexer(input);
+        auto program = ParseProgram(lexer);
+
+        ostringstream output;
+        runtime::SimpleContext context{ output };
+        runtime::Closure closure;
+        const auto start = chrono::steady_clock::now();
+        program->Execute(closure, context);
+        const chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+        return elapsed.count() / ITERATIONS;
+    }
+
+}  // namespace
+
+// 10M ,     ,    
+void RunLoopsBenchmark(ostream& out) {
+    const string n = to_string(ITERATIONS);
+    const string depth = to_string(RECURSION_DEPTH);
+    out << fixed << setprecision(1);
+    out << "for range:  "s << setw(7) << Measure(COUNTER_CLASS + "for i in range("s + n + "):\n"s
+        "  c.total = c.total + i\n"s) << " ns/iteration"s << endl;
+    out << "while:      "s << setw(7) << Measure(COUNTER_CLASS + "i = 0\nwhile i < "s + n + ":\n"s
+        "  c.total = c.total + i\n  i = i + 1\n"s) << " ns/iteration"s << endl;
+    //        RECURSION_DEPTH 
+    out << "recursion:  "s << setw(7) << Measure(COUNTER_CLASS + "for j in range("s
+        + to_string(ITERATIONS / RECURSION_DEPTH) + "):\n  c.count("s + depth + ")\n"s) << " ns/iteration"s << endl;
+    out << "empty loop: "s << setw(7) << Measure("for i in range("s + n + "):\n  continue\n"s)
+        << " ns/iteration"s << endl;
+}
@@ -0,0 +1,127 @@
+#include "async_output.h"
+#include "lexer.h"
+#include "parse.h"
+#include "runtime.h"
+#include "statement.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    //   2^(depth+1) - 1 
+    const string PROGRAM = R"(
+class Printer:
+  def run(n):
+    print 'line', n, 'of the print-heavy benchmark'
+    if n > 0:
+      self.run(n - 1)
+      self.run(n - 1)
+
+p = Printer()
+p.run(16)
+)"s;
+
+    template <typename Run>
+    double MeasureMilliseconds(Run run) {
+        const auto start = chrono::steady_clock::now();
+        run();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    }
+
+}  // namespace
+
+//           SimpleContext  BufferedContext
+void RunOutputBenchmark(ostream& out) {
+    istringstream input(PROGRAM);
+    parse::Lexer lexer(input);
+    auto program = ParseProgram(lexer);
+
+    const char* path = "output_bench.tmp";
+    out << fixed << setprecision(1);
+    {
+        ofstream file(path);
+        const double ms = MeasureMilliseconds([&]() {
+            runtime::SimpleContext context{ file };
+            runtime::Closure closure;
+            program->Execute(closure, context);
+            file.flush();
+        });
+        out << "SimpleContext               "s << setw(8) << ms << " ms"s << endl;
+    }
+    for (auto policy : { runtime::FlushPolicy::WhenFull, runtime::FlushPolicy::EveryLine }) {
+        ofstream file(path);
+        const double ms = MeasureMilliseconds([&]() {
+            runtime::AsyncWriter writer(file);
+            runtime::BufferedContext context(writer, { 64 * 1024, policy, runtime::OutputOrdering::Lines });
+            runtime::Closure closure;
+            program->Execute(closure, context);
+            context.Flush();
+        });
+        out << "BufferedContext    "s << (policy == runtime::FlushPolicy::WhenFull ? "WhenFull "s : "EveryLine"s)
+            << setw(8) << ms << " ms"s << endl;
+    }
+    remove(path);
+
+    //  : Print  ostream  Render  
+    const int value_count = 1000000;
+    runtime::DummyContext dummy;
+    {
+        ostringstream os;
+        const double ms = MeasureMilliseconds([&]() {
+            for (int i = 0; i < value_count; ++i) {
+                runtime::Number(i * 1999).Print(os, dummy);
+                os << ' ';
+            }
+        });
+        out << "Number::Print x1M           "s << setw(8) << ms << " ms"s << endl;
+    }
+    {
+        string text;
+        const double ms = MeasureMilliseconds([&]() {
+            for (int i = 0; i < value_count; ++i) {
+                runtime::Number(i * 1999).Render(text, dummy);
+                text += ' ';
+            }
+        });
+        out << "Number::Render x1M          "s << setw(8) << ms << " ms"s << endl;
+    }
+
+    //   Float  ostream  ,    
+    {
+        ostringstream os;
+        os << setprecision(17);
+        const double ms = MeasureMilliseconds([&]() {
+            for (int i = 0; i < value_count; ++i) {
+                os << i * 0.001 << ' ';
+            }
+        });
+        out << "ostream precision 17 x1M    "s << setw(8) << ms << " ms"s << endl;
+    }
+    {
+        ostringstream os;
+        const double ms = MeasureMilliseconds([&]() {
+            for (int i = 0; i < value_count; ++i) {
+                runtime::Float(i * 0.001).Print(os, dummy);
+                os << ' ';
+            }
+        });
+        out << "Float::Print x1M            "s << setw(8) << ms << " ms"s << endl;
+    }
+    {
+        string text;
+        const double ms = MeasureMilliseconds([&]() {
+            for (int i = 0; i < value_count; ++i) {
+                runtime::Float(i * 0.001).Render(text, dummy);
+                text += ' ';
+            }
+        });
+        out << "Float::Render x1M           "s << setw(8) << ms << " ms"s << endl;
+    }
+}
@@ -0,0 +1,78 @@
+#include "lexer.h"
+#include "parse.h"
+#include "runtime.h"
+#include "statement.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    const string METHOD = R"(
+  def method{1}(a, b):
+    self.value = self.value + a * b - {1}
+    if self.value > 1000:
+      self.value = self.value / 2
+    else:
+      self.value = self.value + 1
+    return 'method{1} of Library{0}: ' + str(self.value)
+)"s;
+
+    //   class_count   method_count ,    
+    string MakeLibraryProgram(int class_count, int method_count) {
+        string program;
+        for (int c = 0; c < class_count; ++c) {
+            program += "class Library"s + to_string(c) + ":\n  def __init__():\n    self.value = 0\n"s;
+            for (int m = 0; m < method_count; ++m) {
+                string method = METHOD;
+                for (size_t pos = method.find("{1}"s); pos != string::npos; pos = method.find("{1}"s, pos)) {
+                    method.replace(pos, 3, to_string(m));
+                }
+                for (size_t pos = method.find("{0}"s); pos != string::npos; pos = method.find("{0}"s, pos)) {
+                    method.replace(pos, 3, to_string(c));
+                }
+                program += method;
+            }
+            program += "\n"s;
+        }
+        program += "x = Library0()\nprint x.method0(2, 3)\n"s;
+        return program;
+    }
+
+    double RunSeconds(const string& program, MethodParsing method_parsing, string& output) {
+        const auto start = chrono::steady_clock::now();
+        istringstream input(program);
+        parse::Lexer lexer(input);
+        auto tree = ParseProgram(lexer, method_parsing);
+
+        runtime::DummyContext context;
+        runtime::Closure closure;
+        tree->Execute(closure, context);
+        const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+        output = context.output.str();
+        return elapsed.count();
+    }
+
+}  // namespace
+
+//     ,        
+void RunParseBenchmark(ostream& out) {
+    const string program = MakeLibraryProgram(200, 20);
+    out << "source: "s << program.size() / 1024 << " KiB, 200 classes x 20 methods"s << endl;
+    out << fixed << setprecision(3);
+
+    string eager_output;
+    string lazy_output;
+    const double eager = RunSeconds(program, MethodParsing::Eager, eager_output);
+    const double lazy = RunSeconds(program, MethodParsing::Lazy, lazy_output);
+    if (eager_output != lazy_output) {
+        throw runtime_error("Lazy method parsing changed program output"s);
+    }
+    out << "eager  "s << setw(8) << eager * 1000 << " ms"s << endl;
+    out << "lazy   "s << setw(8) << lazy * 1000 << " ms"s << endl;
+}
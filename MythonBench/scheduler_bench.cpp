@@ -0,0 +1,90 @@
+#include "executor.h"
+#include "lexer.h"
+#include "parse.h"
+#include "scheduler.h"
+#include "statement.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    //    :   -   
+    string MakeProgram() {
+        string program = R"(
+class Account:
+  def __init__():
+    self.balance = 0
+
+  def deposit(amount):
+    self.balance = self.balance + amount
+
+a = Account()
+)"s;
+        for (int i = 0; i < 40; ++i) {
+            program += "a.deposit(n + "s + to_string(i) + ")\n"s;
+            if (i % 10 == 9) {
+                program += "print 'balance', a.balance\n"s;
+            }
+        }
+        return program;
+    }
+
+    double Milliseconds(executor::Clock::duration d) {
+        return chrono::duration<double, milli>(d).count();
+    }
+
+    void Report(ostream& out, const string& name, const executor::BatchReport& report) {
+        if (report.FailedCount() != 0) {
+            throw runtime_error("Scheduler benchmark job failed: "s + report.jobs.front().error);
+        }
+        out << setw(34) << left << name << right << setw(9) << report.Throughput() << " scripts/s"s
+            << "  p50 "s << setw(8) << Milliseconds(report.LatencyPercentile(0.5)) << " ms"s
+            << "  p99 "s << setw(8) << Milliseconds(report.LatencyPercentile(0.99)) << " ms"s << endl;
+    }
+
+}  // namespace
+
+// 10 000      ,  ,  BatchExecutor,
+//      
+void RunSchedulerBenchmark(ostream& out) {
+    istringstream input(MakeProgram());
+    parse::Lexer lexer(input);
+    shared_ptr<runtime::Executable> program = ParseProgram(lexer);
+
+    const size_t script_count = 10000;
+    out << script_count << " scripts, 44 top-level statements each"s << endl;
+    out << fixed << setprecision(1);
+
+    auto make_jobs = [&](vector<ostringstream>& outputs) {
+        vector<executor::Job> jobs(script_count);
+        for (size_t i = 0; i < script_count; ++i) {
+            jobs[i].program = program;
+            jobs[i].input["n"s] = runtime::ObjectHolder::Own(runtime::Number(static_cast<int>(i)));
+            jobs[i].output = &outputs[i];
+        }
+        return jobs;
+    };
+
+    for (size_t threads : { 1, 4 }) {
+        for (size_t quantum : { 1, 16 }) {
+            vector<ostringstream> outputs(script_count);
+            auto jobs = make_jobs(outputs);
+            const auto report = executor::CooperativeScheduler({ threads, quantum, false }).Run(jobs);
+            Report(out, "scheduler threads "s + to_string(threads) + " quantum "s + to_string(quantum), report);
+        }
+        vector<ostringstream> outputs(script_count);
+        auto jobs = make_jobs(outputs);
+        const auto report = executor::CooperativeScheduler({ threads, 1000, true }).Run(jobs);
+        Report(out, "scheduler threads "s + to_string(threads) + " yield on print"s, report);
+
+        vector<ostringstream> batch_outputs(script_count);
+        auto batch_jobs = make_jobs(batch_outputs);
+        Report(out, "batch executor threads "s + to_string(threads), executor::BatchExecutor(threads).Run(batch_jobs));
+    }
+}
@@ -0,0 +1,45 @@
+#include "load_client.h"
+#include "server.h"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    const string PROGRAM = R"(
+class Greeter:
+  def greet(name):
+    return 'hello, ' + name
+
+g = Greeter()
+print g.greet(stdin)
+)"s;
+
+}  // namespace
+
+//     ,     
+void RunServerBenchmark(ostream& out) {
+    const string socket_path = "mython_server_bench.sock"s;
+    server::Server server(socket_path, { 4 });
+    server.Start();
+
+    for (size_t connections : { 1, 4 }) {
+        server::LoadOptions options;
+        options.socket_path = socket_path;
+        options.program = PROGRAM;
+        options.input = "bench"s;
+        options.connections = connections;
+        options.requests = 20000;
+
+        const server::LoadReport report = server::RunLoad(options);
+        if (report.failed != 0) {
+            throw runtime_error("Server benchmark request failed: "s + report.first_error);
+        }
+        out << fixed << setprecision(1) << connections << " connections, "s << report.Throughput() << " requests/s"s << endl;
+        report.latencies.Print(out);
+    }
+    out << "program cache hits "s << server.GetCache().GetHits() << ", misses "s << server.GetCache().GetMisses() << endl;
+}
@@ -0,0 +1,96 @@
+#include "lexer.h"
+#include "parse.h"
+#include "snapshot.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    //        
+    string MakePrelude(int class_count) {
+        string prelude;
+        for (int i = 0; i < class_count; ++i) {
+            const string name = "Service"s + to_string(i);
+            prelude += "class "s + name + ":\n"s
+                + "  def __init__():\n"s
+                + "    self.calls = 0\n"s
+                + "\n"s
+                + "  def handle(x):\n"s
+                + "    self.calls = self.calls + 1\n"s
+                + "    if x > 10:\n"s
+                + "      return x - 10\n"s
+                + "    return x + "s + to_string(i) + "\n"s
+                + "\n"s
+                + "  def __str__():\n"s
+                + "    return '"s + name + "'\n"s
+                + "\n"s;
+        }
+        for (int i = 0; i < 8; ++i) {
+            prelude += "service"s + to_string(i) + " = Service"s + to_string(i) + "()\n"s;
+        }
+        prelude += "limit = 100\n"s;
+        return prelude;
+    }
+
+    const string REQUEST = R"(
+service3.handle(5)
+print service3, service3.calls, limit
+)"s;
+
+    template <typename Run>
+    double MeasureMicroseconds(int iterations, Run run) {
+        const auto start = chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            run();
+        }
+        return chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / iterations;
+    }
+
+}  // namespace
+
+//   :        
+void RunSnapshotBenchmark(ostream& out) {
+    const string prelude = MakePrelude(100);
+    out << "prelude of 100 classes, "s << prelude.size() << " bytes"s << endl;
+    out << fixed << setprecision(2);
+
+    const double full = MeasureMicroseconds(200, [&]() {
+        istringstream input(prelude + REQUEST);
+        ostringstream output;
+        parse::Lexer lexer(input);
+        auto program = ParseProgram(lexer);
+        runtime::SimpleContext context{ output };
+        runtime::Closure closure;
+        program->Execute(closure, context);
+    });
+    out << "prelude + request each time   "s << setw(10) << full << " us/request"s << endl;
+
+    istringstream prelude_input(prelude);
+    ostringstream prelude_output;
+    auto snapshot = PreludeSnapshot::Create(prelude_input, prelude_output);
+
+    const double run = MeasureMicroseconds(20000, [&]() {
+        istringstream input(REQUEST);
+        ostringstream output;
+        runtime::SimpleContext context{ output };
+        snapshot->Run(input, context);
+    });
+    out << "snapshot, parse request       "s << setw(10) << run << " us/request"s << endl;
+
+    istringstream request_input(REQUEST);
+    parse::Lexer request_lexer(request_input);
+    auto request = snapshot->Parse(request_lexer);
+    const double clone = MeasureMicroseconds(20000, [&]() {
+        ostringstream output;
+        runtime::SimpleContext context{ output };
+        runtime::Closure closure = snapshot->Clone();
+        request->Execute(closure, context);
+    });
+    out << "snapshot, pre-parsed request  "s << setw(10) << clone << " us/request"s << endl;
+}
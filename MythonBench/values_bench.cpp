@@ -0,0 +1,79 @@
+#include "cycle_collector.h"
+#include "lexer.h"
+#include "parse.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    //          ,
+    //       
+    string MakeProgram(int lines) {
+        string program = R"(
+class Point:
+  def __init__(x, y):
+    self.x = x
+    self.y = y
+
+p = Point(1, 2)
+a = 1
+b = 2
+)"s;
+        for (int i = 0; i < lines; ++i) {
+            const string n = to_string(i % 97);
+            program += "a = (a * 3 + b - "s + n + ") / 4 + 1\n"s;
+            program += "if a > b and not a == "s + n + ":\n"s;
+            program += "  b = b + 1\n"s;
+            program += "p.x = p.x - a / (b + 1) + 1\n"s;
+        }
+        return program;
+    }
+
+}  // namespace
+
+//           
+void RunValuesBenchmark(ostream& out) {
+    istringstream input(MakeProgram(2000));
+    parse::Lexer lexer(input);
+    auto program = ParseProgram(lexer);
+
+    const int runs = 200;
+    const auto start = chrono::steady_clock::now();
+    for (int i = 0; i < runs; ++i) {
+        ostringstream output;
+        runtime::SimpleContext context{ output };
+        runtime::CycleCollector collector;
+        context.SetCycleCollector(&collector);
+        runtime::Closure closure;
+        program->Execute(closure, context);
+    }
+    const chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+
+    out << fixed << setprecision(2);
+    out << runs << " runs of 8000 statements   "s << setw(10) << elapsed.count() << " ms, "s
+        << setw(8) << runs * 8000.0 / elapsed.count() / 1000.0 << " M statements/s"s << endl;
+    //      :         
+    auto memory = make_shared<runtime::MemoryAccount>();
+    const auto accounted_start = chrono::steady_clock::now();
+    {
+        const runtime::MemoryAccount::Scope memory_scope(memory);
+        for (int i = 0; i < runs; ++i) {
+            ostringstream output;
+            runtime::SimpleContext context{ output };
+            runtime::CycleCollector collector;
+            context.SetCycleCollector(&collector);
+            runtime::Closure closure;
+            program->Execute(closure, context);
+        }
+    }
+    const chrono::duration<double, milli> accounted = chrono::steady_clock::now() - accounted_start;
+    out << "with memory accounting       "s << setw(10) << accounted.count() << " ms, peak "s
+        << memory->GetStats().peak_bytes << " bytes"s << endl;
+}
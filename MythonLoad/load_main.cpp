@@ -0,0 +1,86 @@
+#include "load_client.h"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+namespace {
+
+    void PrintUsage(ostream& out) {
+        out << "Usage: MythonLoad --socket <path> -i <program> [--input <text>] [--connections N] [--requests N]\n"sv
+            << "  --socket <path>     Unix domain socket of a running 'Mython --serve'\n"sv
+            << "  -i <program>        file with the Mython program sent in every request\n"sv
+            << "  --input <text>      value of the stdin variable in the program\n"sv
+            << "  --connections N     concurrent connections, 4 by default\n"sv
+            << "  --requests N        total number of requests, 1000 by default\n"sv;
+    }
+
+    optional<server::LoadOptions> ParseOptions(int argc, char** argv) {
+        server::LoadOptions options;
+        string program_path;
+        for (int i = 1; i < argc; ++i) {
+            const string_view arg = argv[i];
+            if (i + 1 >= argc) {
+                return nullopt;
+            }
+            if (arg == "--socket"sv) {
+                options.socket_path = argv[++i];
+            }
+            else if (arg == "-i"sv) {
+                program_path = argv[++i];
+            }
+            else if (arg == "--input"sv) {
+                options.input = argv[++i];
+            }
+            else if (arg == "--connections"sv) {
+                options.connections = stoul(argv[++i]);
+            }
+            else if (arg == "--requests"sv) {
+                options.requests = stoul(argv[++i]);
+            }
+            else {
+                return nullopt;
+            }
+        }
+        if (options.socket_path.empty() || program_path.empty()) {
+            return nullopt;
+        }
+        ifstream program(program_path);
+        if (!program) {
+            cerr << "Can't open program file "sv << program_path << endl;
+            return nullopt;
+        }
+        options.program.assign(istreambuf_iterator<char>(program), istreambuf_iterator<char>());
+        return options;
+    }
+
+}  // namespace
+
+//     Mython:      
+int main(int argc, char** argv) {
+    try {
+        const auto options = ParseOptions(argc, argv);
+        if (!options) {
+            PrintUsage(cerr);
+            return 2;
+        }
+
+        const server::LoadReport report = server::RunLoad(*options);
+        cout << options->connections << " connections, "s << report.Throughput() << " requests/s, "s
+             << report.failed << " failed"s << endl;
+        if (report.failed != 0) {
+            cout << "first error: "s << report.first_error << endl;
+        }
+        report.latencies.Print(cout);
+        return report.failed == 0 ? 0 : 1;
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,149 @@
+#include "async_output.h"
+#include "interpreter.h"
+
+#include "test_runner_p.h"
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace runtime {
+
+    namespace {
+
+        void TestBufferedContextMatchesSimpleContext() {
+            const string program = R"(
+class Counter:
+  def __init__():
+    self.value = 0
+
+  def add(n):
+    self.value = self.value + n
+    print 'added', n, 'total', self.value
+
+c = Counter()
+c.add(1)
+c.add(20)
+c.add(300)
+print c.value, 'done', None, True
+)"s;
+
+            ostringstream expected;
+            {
+                istringstream input(program);
+                RunMythonProgram(input, expected);
+            }
+
+            for (auto ordering : { OutputOrdering::Bytes, OutputOrdering::Lines }) {
+                for (auto policy : { FlushPolicy::WhenFull, FlushPolicy::EveryLine }) {
+                    for (size_t buffer_size : { 1, 7, 64 * 1024 }) {
+                        ostringstream output;
+                        {
+                            AsyncWriter writer(output);
+                            BufferedContext context(writer, { buffer_size, policy, ordering });
+                            istringstream input(program);
+                            RunMythonProgram(input, context);
+                        }
+                        ASSERT_EQUAL(output.str(), expected.str());
+                    }
+                }
+            }
+        }
+
+        void TestFlushWritesEverything() {
+            ostringstream output;
+            AsyncWriter writer(output);
+            BufferedContext context(writer, { 1024, FlushPolicy::WhenFull, OutputOrdering::Lines });
+
+            context.GetOutputStream() << "no newline yet"s;
+            context.Flush();
+            ASSERT_EQUAL(output.str(), "no newline yet"s);
+
+            context.GetOutputStream() << "\nmore\n"s;
+            context.Flush();
+            ASSERT_EQUAL(output.str(), "no newline yet\nmore\n"s);
+        }
+
+        void TestEveryLinePolicyHandsOverCompleteLines() {
+            ostringstream output;
+            AsyncWriter writer(output);
+            BufferedContext context(writer, { 1024, FlushPolicy::EveryLine, OutputOrdering::Lines });
+
+            context.GetOutputStream() << "first\nsecond"s;
+            // Flush     ,    
+            writer.Flush();
+            ASSERT_EQUAL(output.str(), "first\n"s);
+
+            context.Flush();
+            ASSERT_EQUAL(output.str(), "first\nsecond"s);
+        }
+
+        void TestLinesLongerThanBufferAreKeptWhole() {
+            ostringstream output;
+            AsyncWriter writer(output);
+            BufferedContext context(writer, { 4, FlushPolicy::WhenFull, OutputOrdering::Lines });
+
+            const string long_line(100, 'x');
+            context.GetOutputStream() << long_line;
+            writer.Flush();
+            ASSERT_EQUAL(output.str(), ""s);
+
+            context.GetOutputStream() << '\n';
+            context.Flush();
+            ASSERT_EQUAL(output.str(), long_line + '\n');
+        }
+
+        void TestContextsSharingWriterDoNotSplitLines() {
+            ostringstream output;
+            const size_t thread_count = 4;
+            const size_t line_count = 2000;
+            {
+                AsyncWriter writer(output);
+                vector<thread> threads;
+                for (size_t t = 0; t < thread_count; ++t) {
+                    threads.emplace_back([&writer, t]() {
+                        BufferedContext context(writer, { 64, FlushPolicy::WhenFull, OutputOrdering::Lines });
+                        for (size_t i = 0; i < line_count; ++i) {
+                            context.GetOutputStream() << "thread "s << t << " line "s << i << '\n';
+                        }
+                    });
+                }
+                for (auto& th : threads) {
+                    th.join();
+                }
+            }
+
+            istringstream lines(output.str());
+            vector<size_t> next_line(thread_count, 0);
+            string line;
+            while (getline(lines, line)) {
+                istringstream words(line);
+                string thread_word, line_word;
+                size_t t = thread_count, i = 0;
+                words >> thread_word >> t >> line_word >> i;
+                ASSERT_EQUAL(thread_word, "thread"s);
+                ASSERT_EQUAL(line_word, "line"s);
+                ASSERT(t < thread_count);
+                //      
+                ASSERT_EQUAL(i, next_line[t]);
+                ++next_line[t];
+            }
+            for (size_t count : next_line) {
+                ASSERT_EQUAL(count, line_count);
+            }
+        }
+
+    }  // namespace
+
+    void RunAsyncOutputTests(TestRunner& tr) {
+        RUN_TEST(tr, TestBufferedContextMatchesSimpleContext);
+        RUN_TEST(tr, TestFlushWritesEverything);
+        RUN_TEST(tr, TestEveryLinePolicyHandsOverCompleteLines);
+        RUN_TEST(tr, TestLinesLongerThanBufferAreKeptWhole);
+        RUN_TEST(tr, TestContextsSharingWriterDoNotSplitLines);
+    }
+
+}  // namespace runtime
@@ -0,0 +1,242 @@
+#include "cycle_collector.h"
+#include "lexer.h"
+#include "parse.h"
+#include "statement.h"
+
+#include "test_runner_p.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace runtime {
+
+    namespace {
+
+        void RunProgram(const string& source, Closure& closure, Context& context) {
+            istringstream input(source);
+            parse::Lexer lexer(input);
+            auto program = ParseProgram(lexer);
+            program->Execute(closure, context);
+        }
+
+        const string NODES = R"(
+class Node:
+  def __init__(name):
+    self.name = name
+
+  def __str__():
+    return self.name
+
+)"s;
+
+        void TestUnreachableCycleIsCollected() {
+            ostringstream output;
+            SimpleContext context{ output };
+            CycleCollector collector(1000);
+            context.SetCycleCollector(&collector);
+
+            weak_ptr<Object> first;
+            {
+                Closure closure;
+                RunProgram(NODES + "a = Node('a')\nb = Node('b')\nc = Node('c')\na.next = b\nb.next = c\nc.next = a\n"s,
+                    closure, context);
+                first = closure.at("a"s).GetWeakPtr();
+                ASSERT_EQUAL(collector.GetTrackedCount(), 3U);
+                //   ,  
+                ASSERT_EQUAL(collector.Collect(), 0U);
+                ASSERT(!first.expired());
+            }
+            //       
+            ASSERT(!first.expired());
+            ASSERT_EQUAL(collector.Collect(), 3U);
+            ASSERT(first.expired());
+            ASSERT_EQUAL(collector.GetTrackedCount(), 0U);
+
+            const auto& stats = collector.GetStats();
+            ASSERT_EQUAL(stats.collections, 2U);
+            ASSERT_EQUAL(stats.reclaimed_objects, 3U);
+            ASSERT(stats.reclaimed_bytes >= 3 * sizeof(ClassInstance));
+            ASSERT(stats.max_pause >= stats.last_pause);
+        }
+
+        void TestCycleReachableFromLiveObjectSurvives() {
+            ostringstream output;
+            SimpleContext context{ output };
+            CycleCollector collector(1000);
+            context.SetCycleCollector(&collector);
+
+            Closure closure;
+            RunProgram(NODES + R"(
+holder = Node('holder')
+a = Node('a')
+b = Node('b')
+a.next = b
+b.prev = a
+holder.next = a
+a = None
+b = None
+)"s, closure, context);
+            ASSERT_EQUAL(collector.Collect(), 0U);
+
+            //  a <-> b     holder
+            RunProgram("print holder.next, holder.next.next, holder.next.next.prev\nholder.next = None\n"s,
+                closure, context);
+            ASSERT_EQUAL(output.str(), "a b a\n"s);
+            ASSERT_EQUAL(collector.Collect(), 2U);
+            ASSERT_EQUAL(collector.GetTrackedCount(), 1U);
+        }
+
+        void TestCollectionIsTriggeredByAllocations() {
+            ostringstream output;
+            SimpleContext context{ output };
+            CycleCollector collector(8);
+            context.SetCycleCollector(&collector);
+
+            //   make     
+            string source = NODES + R"(
+class Factory:
+  def make():
+    x = Node('x')
+    y = Node('y')
+    x.next = y
+    y.prev = x
+
+f = Factory()
+)"s;
+            for (int i = 0; i < 20; ++i) {
+                source += "f.make()\n"s;
+            }
+            Closure closure;
+            RunProgram(source, closure, context);
+
+            const auto& stats = collector.GetStats();
+            ASSERT(stats.collections >= 4);
+            ASSERT(stats.reclaimed_objects >= 32);
+            //       41 
+            ASSERT(collector.GetTrackedCount() <= 9);
+        }
+
+        void TestInterpreterCollectsLeftoverCycles() {
+            weak_ptr<Object> leaked;
+            {
+                ostringstream output;
+                SimpleContext context{ output };
+                CycleCollector collector;
+                context.SetCycleCollector(&collector);
+                Closure closure;
+                RunProgram(NODES + "a = Node('a')\nb = Node('b')\na.next = b\nb.prev = a\nprint a.next\n"s, closure, context);
+                leaked = closure.at("b"s).GetWeakPtr();
+                closure.clear();
+                ASSERT_EQUAL(output.str(), "b\n"s);
+            }
+            //    ,  
+            ASSERT(leaked.expired());
+        }
+
+        void TestCyclesThroughListsAreCollected() {
+            ostringstream output;
+            SimpleContext context{ output };
+            CycleCollector collector(1000);
+            context.SetCycleCollector(&collector);
+
+            weak_ptr<Object> items;
+            weak_ptr<Object> self_list;
+            {
+                Closure closure;
+                RunProgram(NODES + "a = Node('a')\nb = Node('b')\na.children = [b, 1]\nb.parent = a\n"
+                    "s = []\ns.append(s)\nprint s\n"s, closure, context);
+                items = closure.at("a"s).TryAs<ClassInstance>()->Fields().at("children"s).GetWeakPtr();
+                self_list = closure.at("s"s).GetWeakPtr();
+                ASSERT_EQUAL(collector.GetTrackedCount(), 4U);
+                ASSERT_EQUAL(collector.Collect(), 0U);
+            }
+            ASSERT_EQUAL(output.str(), "[[...]]\n"s);
+            ASSERT(!items.expired());
+            ASSERT(!self_list.expired());
+            ASSERT_EQUAL(collector.Collect(), 4U);
+            ASSERT(items.expired());
+            ASSERT(self_list.expired());
+            ASSERT(collector.GetStats().reclaimed_bytes >= 2 * sizeof(List));
+        }
+
+        void TestCyclesThroughDictsAreCollected() {
+            ostringstream output;
+            SimpleContext context{ output };
+            CycleCollector collector(1000);
+            context.SetCycleCollector(&collector);
+
+            weak_ptr<Object> index;
+            weak_ptr<Object> self_dict;
+            {
+                Closure closure;
+                //      ,  
+                RunProgram(NODES + "a = Node('a')\na.index = {'self': a, a: 1}\n"
+                    "d = {}\nd['me'] = d\nprint d\n"s, closure, context);
+                index = closure.at("a"s).TryAs<ClassInstance>()->Fields().at("index"s).GetWeakPtr();
+                self_dict = closure.at("d"s).GetWeakPtr();
+                ASSERT_EQUAL(collector.GetTrackedCount(), 3U);
+                ASSERT_EQUAL(collector.Collect(), 0U);
+            }
+            ASSERT_EQUAL(output.str(), "{'me': {...}}\n"s);
+            ASSERT(!index.expired());
+            ASSERT(!self_dict.expired());
+            ASSERT_EQUAL(collector.Collect(), 3U);
+            ASSERT(index.expired());
+            ASSERT(self_dict.expired());
+        }
+
+        void TestSelfReferencesAreOwned() {
+            ostringstream output;
+            SimpleContext context{ output };
+            CycleCollector collector(1000);
+            context.SetCycleCollector(&collector);
+
+            weak_ptr<Object> first;
+            {
+                Closure closure;
+                RunProgram(NODES + R"(
+class Registry:
+  def add(node):
+    self.last = node
+
+class Linked(Node):
+  def attach(registry, other):
+    registry.add(self)
+    self.next = other
+    other.prev = self
+
+r = Registry()
+a = Linked('a')
+b = Linked('b')
+a.attach(r, b)
+a = None
+b = None
+print r.last, r.last.next, r.last.next.prev
+)"s, closure, context);
+                //   self,    ,  
+                ASSERT_EQUAL(output.str(), "a b a\n"s);
+                first = closure.at("r"s).TryAs<ClassInstance>()->Fields().at("last"s).GetWeakPtr();
+                ASSERT_EQUAL(collector.Collect(), 0U);
+            }
+            // a.next  b.prev   ,   
+            ASSERT(!first.expired());
+            ASSERT_EQUAL(collector.Collect(), 2U);
+            ASSERT(first.expired());
+        }
+
+    }  // namespace
+
+    void RunCycleCollectorTests(TestRunner& tr) {
+        RUN_TEST(tr, TestUnreachableCycleIsCollected);
+        RUN_TEST(tr, TestCycleReachableFromLiveObjectSurvives);
+        RUN_TEST(tr, TestCollectionIsTriggeredByAllocations);
+        RUN_TEST(tr, TestInterpreterCollectsLeftoverCycles);
+        RUN_TEST(tr, TestCyclesThroughListsAreCollected);
+        RUN_TEST(tr, TestCyclesThroughDictsAreCollected);
+        RUN_TEST(tr, TestSelfReferencesAreOwned);
+    }
+
+}  // namespace runtime
@@ -0,0 +1,176 @@
+#include "executor.h"
+#include "lexer.h"
+#include "parse.h"
+#include "statement.h"
+
+#include "test_runner_p.h"
+
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace executor {
+
+    namespace {
+        shared_ptr<runtime::Executable> ParseShared(const string& source) {
+            istringstream input(source);
+            parse::Lexer lexer(input);
+            return ParseProgram(lexer);
+        }
+
+        void TestRunsEveryJobInIsolation() {
+            auto program = ParseShared(R"(
+class Accumulator:
+  def __init__():
+    self.total = 0
+
+  def add(value):
+    self.total = self.total + value
+
+acc = Accumulator()
+acc.add(n)
+acc.add(n * 2)
+counter = n + 1
+print name, acc.total, counter
+)"s);
+
+            const int job_count = 200;
+            vector<ostringstream> outputs(job_count);
+            vector<Job> jobs;
+            for (int i = 0; i < job_count; ++i) {
+                Job job;
+                job.program = program;
+                job.input["n"s] = runtime::ObjectHolder::Own(runtime::Number(i));
+                job.input["name"s] = runtime::ObjectHolder::Own(runtime::String("job"s + to_string(i)));
+                job.output = &outputs[i];
+                jobs.push_back(std::move(job));
+            }
+
+            BatchExecutor executor(4);
+            ASSERT_EQUAL(executor.ThreadCount(), 4u);
+            const BatchReport report = executor.Run(jobs);
+
+            ASSERT_EQUAL(report.jobs.size(), static_cast<size_t>(job_count));
+            ASSERT_EQUAL(report.FailedCount(), 0u);
+            for (int i = 0; i < job_count; ++i) {
+                ASSERT(report.jobs[i].ok);
+                ASSERT(report.jobs[i].worker < 4u);
+                ASSERT_EQUAL(outputs[i].str(),
+                    "job"s + to_string(i) + " "s + to_string(i * 3) + " "s + to_string(i + 1) + "\n"s);
+                //      
+                ASSERT(jobs[i].input.count("acc"s) == 0);
+            }
+            ASSERT(report.Throughput() > 0);
+            ASSERT(report.LatencyPercentile(0.5) <= report.LatencyPercentile(1.0));
+            ASSERT(report.LatencyPercentile(1.0) <= report.wall_time);
+        }
+
+        void TestFailedJobDoesNotAffectOthers() {
+            auto good = ParseShared("print 'ok'\n"s);
+            auto bad = ParseShared("print 1 + 'a'\n"s);
+
+            ostringstream out[3];
+            vector<Job> jobs(3);
+            jobs[0].program = good;
+            jobs[0].output = &out[0];
+            jobs[1].program = bad;
+            jobs[1].output = &out[1];
+            jobs[2].program = good;
+            jobs[2].output = &out[2];
+
+            const BatchReport report = BatchExecutor(2).Run(jobs);
+            ASSERT_EQUAL(report.FailedCount(), 1u);
+            ASSERT(report.jobs[0].ok && report.jobs[2].ok);
+            ASSERT(!report.jobs[1].ok);
+            ASSERT_EQUAL(out[0].str(), "ok\n"s);
+            ASSERT_EQUAL(out[2].str(), "ok\n"s);
+
+            vector<Job> empty;
+            ASSERT(BatchExecutor(2).Run(empty).jobs.empty());
+        }
+
+        void TestRunawayJobIsAborted() {
+            auto runaway = ParseShared(R"(
+class Loop:
+  def spin(n):
+    self.spin(n + 1)
+
+l = Loop()
+l.spin(0)
+)"s);
+            auto good = ParseShared("print 'ok'\n"s);
+
+            ostringstream out[2];
+            vector<Job> jobs(2);
+            jobs[0].program = runaway;
+            jobs[0].output = &out[0];
+            jobs[0].fuel_limit = 500;
+            jobs[1].program = good;
+            jobs[1].output = &out[1];
+            jobs[1].fuel_limit = 500;
+
+            const BatchReport report = BatchExecutor(2).Run(jobs);
+            ASSERT(!report.jobs[0].ok);
+            ASSERT_EQUAL(report.jobs[0].error, string(runtime::FuelExhausted().what()));
+            ASSERT_EQUAL(report.jobs[0].fuel_used, 501u);
+            ASSERT(report.jobs[1].ok);
+            ASSERT_EQUAL(out[1].str(), "ok\n"s);
+        }
+
+        void TestMemoryLimitAbortsJob() {
+            //    s,     
+            string source = "s = 'abcdefgh'\n"s;
+            for (int i = 0; i < 24; ++i) {
+                source += "s = s + s\n"s;
+            }
+            auto hungry = ParseShared(source);
+            auto good = ParseShared("x = 'small'\nprint x\n"s);
+
+            ostringstream out[2];
+            vector<Job> jobs(2);
+            jobs[0].program = hungry;
+            jobs[0].output = &out[0];
+            jobs[0].memory_limit = 1 << 20;
+            jobs[1].program = good;
+            jobs[1].output = &out[1];
+            jobs[1].memory_limit = 1 << 20;
+
+            const BatchReport report = BatchExecutor(2).Run(jobs);
+            ASSERT(!report.jobs[0].ok);
+            ASSERT_EQUAL(report.jobs[0].error, string(runtime::MemoryLimitExceeded().what()));
+            ASSERT(report.jobs[0].memory.peak_bytes <= (1u << 20));
+            ASSERT(report.jobs[0].memory.peak_bytes >= (1u << 18));
+            ASSERT(report.jobs[1].ok);
+            ASSERT_EQUAL(out[1].str(), "small\n"s);
+            ASSERT(report.jobs[1].memory.live_bytes > 0);
+        }
+
+        void TestMemoryIsAccountedOnRequest() {
+            auto program = ParseShared("s = 'a rather long string that does not fit into the short string buffer'\n"s);
+
+            ostringstream out[2];
+            vector<Job> jobs(2);
+            jobs[0].program = program;
+            jobs[0].output = &out[0];
+            jobs[1].program = program;
+            jobs[1].output = &out[1];
+            jobs[1].memory_stats = true;
+
+            const BatchReport report = BatchExecutor(2).Run(jobs);
+            ASSERT(report.jobs[0].ok);
+            ASSERT_EQUAL(report.jobs[0].memory.peak_bytes, 0u);
+            ASSERT(report.jobs[1].ok);
+            ASSERT(report.jobs[1].memory.peak_bytes > 0);
+        }
+    }  // namespace
+
+    void RunExecutorTests(TestRunner& tr) {
+        RUN_TEST(tr, executor::TestRunsEveryJobInIsolation);
+        RUN_TEST(tr, executor::TestFailedJobDoesNotAffectOthers);
+        RUN_TEST(tr, executor::TestRunawayJobIsAborted);
+        RUN_TEST(tr, executor::TestMemoryLimitAbortsJob);
+        RUN_TEST(tr, executor::TestMemoryIsAccountedOnRequest);
+    }
+
+}  // namespace executor
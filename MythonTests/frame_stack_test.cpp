@@ -0,0 +1,231 @@
+#include "frame_stack.h"
+#include "lexer.h"
+#include "parse.h"
+#include "statement.h"
+
+#include "test_runner_p.h"
+
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+    //          .   
+    // operator new  operator delete    malloc  free
+    thread_local bool heap_counting = false;
+    thread_local size_t heap_allocations = 0;
+
+    void* CountedAllocate(size_t size) noexcept {
+        if (heap_counting) {
+            ++heap_allocations;
+        }
+        return malloc(size == 0 ? 1 : size);
+    }
+
+    // ,       
+    class HeapCountingWindow {
+    public:
+        HeapCountingWindow() {
+            heap_allocations = 0;
+            heap_counting = true;
+        }
+        ~HeapCountingWindow() {
+            heap_counting = false;
+        }
+
+        HeapCountingWindow(const HeapCountingWindow&) = delete;
+        HeapCountingWindow& operator=(const HeapCountingWindow&) = delete;
+
+        [[nodiscard]] size_t GetAllocations() const {
+            return heap_allocations;
+        }
+    };
+}  // namespace
+
+void* operator new(size_t size) {
+    if (void* ptr = CountedAllocate(size)) {
+        return ptr;
+    }
+    throw bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const nothrow_t&) noexcept {
+    return CountedAllocate(size);
+}
+
+void* operator new[](size_t size, const nothrow_t&) noexcept {
+    return CountedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, const nothrow_t&) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, const nothrow_t&) noexcept {
+    free(ptr);
+}
+
+namespace runtime {
+
+    namespace {
+
+        unique_ptr<ast::Statement> Parse(const string& source) {
+            istringstream input(source);
+            parse::Lexer lexer(input);
+            return ParseProgram(lexer);
+        }
+
+        const string COUNTER = R"(
+class Counter:
+  def __init__():
+    self.last = None
+
+  def step(a, b):
+    tmp = b
+    self.last = a
+
+  def twice(a, b):
+    self.step(a, b)
+    self.step(b, a)
+
+counter = Counter()
+x = 1
+y = 'y'
+)"s;
+
+        //        
+        size_t CountCallAllocations(const string& call) {
+            ostringstream output;
+            SimpleContext context{ output };
+            Closure closure;
+            Parse(COUNTER)->Execute(closure, context);
+            auto program = Parse(call);
+
+            //      
+            for (int i = 0; i < 3; ++i) {
+                program->Execute(closure, context);
+            }
+            const FrameStack& stack = FrameStack::ForThread();
+            const size_t stack_before = stack.GetAllocations();
+            size_t heap_allocations = 0;
+            {
+                const HeapCountingWindow window;
+                for (int i = 0; i < 100; ++i) {
+                    program->Execute(closure, context);
+                }
+                heap_allocations = window.GetAllocations();
+            }
+            //    ,        
+            ASSERT_EQUAL(stack.GetAllocations(), stack_before);
+            return heap_allocations;
+        }
+
+        void TestMethodCallDoesNotAllocate() {
+            ASSERT_EQUAL(CountCallAllocations("counter.step(x, y)\n"s), 0U);
+        }
+
+        void TestNestedMethodCallsDoNotAllocate() {
+            ASSERT_EQUAL(CountCallAllocations("counter.twice(x, y)\n"s), 0U);
+            ASSERT_EQUAL(CountCallAllocations("counter.step(counter.step(x, y), counter.twice(y, x))\n"s), 0U);
+        }
+
+        void TestCountingSeesAllocations() {
+            //            
+            ASSERT(CountCallAllocations("counter.step(x, y + ' and a rather long string that needs the heap')\n"s) >= 100);
+        }
+
+        void TestArgumentsAreMovedIntoFrame() {
+            ostringstream output;
+            SimpleContext context{ output };
+            Closure closure;
+            Parse(COUNTER)->Execute(closure, context);
+
+            ObjectHolder value = ObjectHolder::Own(String("value"s));
+            weak_ptr<Object> weak = value.GetWeakPtr();
+            FrameStack& stack = FrameStack::ForThread();
+            {
+                FrameStack::ArgumentFrame args(stack);
+                args.Push(std::move(value));
+                args.Push(ObjectHolder::None());
+                closure.at("counter"s).TryAs<ClassInstance>()->Call("step"s, args.Get(), context);
+                //    ,      
+                ASSERT(!args.Get().data[0]);
+            }
+            closure.at("counter"s).TryAs<ClassInstance>()->SetField("last"s, ObjectHolder::None());
+            //       
+            ASSERT(weak.expired());
+        }
+
+        void TestFirstCallGrowsStack() {
+            ostringstream output;
+            SimpleContext context{ output };
+            Closure closure;
+            Parse(COUNTER)->Execute(closure, context);
+
+            //          
+            const FrameStack& stack = FrameStack::ForThread();
+            const size_t before = stack.GetAllocations();
+            Parse(R"(
+class Deep:
+  def down(n):
+    if n > 0:
+      self.down(n - 1)
+
+deep = Deep()
+deep.down(1000)
+)"s)->Execute(closure, context);
+            ASSERT(stack.GetAllocations() > before);
+        }
+
+        void TestRecursiveFramesAreIndependent() {
+            ostringstream output;
+            SimpleContext context{ output };
+            Closure closure;
+            Parse(R"(
+class Walker:
+  def walk(depth, label):
+    if depth > 0:
+      self.walk(depth - 1, label + '.')
+    print depth, label
+
+walker = Walker()
+walker.walk(3, 'a')
+)"s)->Execute(closure, context);
+            ASSERT_EQUAL(output.str(), "0 a...\n1 a..\n2 a.\n3 a\n"s);
+        }
+
+    }  // namespace
+
+    void RunFrameStackTests(TestRunner& tr) {
+        RUN_TEST(tr, TestMethodCallDoesNotAllocate);
+        RUN_TEST(tr, TestNestedMethodCallsDoNotAllocate);
+        RUN_TEST(tr, TestCountingSeesAllocations);
+        RUN_TEST(tr, TestArgumentsAreMovedIntoFrame);
+        RUN_TEST(tr, TestFirstCallGrowsStack);
+        RUN_TEST(tr, TestRecursiveFramesAreIndependent);
+    }
+
+}  // namespace runtime
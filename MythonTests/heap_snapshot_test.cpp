@@ -0,0 +1,174 @@
+#include "cycle_collector.h"
+#include "heap_snapshot.h"
+#include "lexer.h"
+#include "parse.h"
+#include "statement.h"
+
+#include "test_runner_p.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace runtime {
+
+    namespace {
+
+        const string PROGRAM = R"(
+class Node:
+  def __init__(value):
+    self.value = value
+
+class Cache:
+  def __init__():
+    self.size = 0
+
+cache = Cache()
+cache.head = Node('a value long enough to live on the heap, not in the short string buffer')
+cache.head.next = Node('tail')
+cache.head.next.next = cache.head
+shared = Node('shared')
+cache.shared = shared
+flag = True
+nothing = None
+)"s;
+
+        HeapSnapshot TakeSnapshot(const string& source) {
+            istringstream input(source);
+            parse::Lexer lexer(input);
+            auto program = ParseProgram(lexer);
+            ostringstream output;
+            SimpleContext context{ output };
+            //    head <-> tail,   
+            CycleCollector collector;
+            context.SetCycleCollector(&collector);
+            Closure closure;
+            program->Execute(closure, context);
+            return HeapSnapshot::Take(closure);
+        }
+
+        const HeapNode& FollowPath(const HeapSnapshot& snapshot, const vector<string>& path) {
+            uint32_t node = HeapSnapshot::ROOT;
+            for (const string& name : path) {
+                const auto& edges = snapshot.GetNodes()[node].edges;
+                auto it = find_if(edges.begin(), edges.end(), [&](const HeapEdge& edge) {
+                    return edge.name == name;
+                });
+                ASSERT(it != edges.end());
+                node = it->target;
+            }
+            return snapshot.GetNodes()[node];
+        }
+
+        void TestSnapshotDescribesObjectGraph() {
+            const HeapSnapshot snapshot = TakeSnapshot(PROGRAM);
+            const auto& root = snapshot.GetNodes()[HeapSnapshot::ROOT];
+            // None    ,    
+            ASSERT_EQUAL(root.edges.size(), 5u);
+            ASSERT_EQUAL(root.edges.front().name, "Cache"s);
+
+            const HeapNode& cache = FollowPath(snapshot, { "cache"s });
+            ASSERT_EQUAL(cache.type, "Instance"s);
+            ASSERT_EQUAL(cache.class_name, "Cache"s);
+            ASSERT_EQUAL(cache.edges.size(), 3u);
+            ASSERT_EQUAL(FollowPath(snapshot, { "Node"s }).type, "Class"s);
+            ASSERT_EQUAL(FollowPath(snapshot, { "flag"s }).type, "Bool"s);
+
+            //  head <-> tail    
+            const HeapNode& head = FollowPath(snapshot, { "cache"s, "head"s });
+            ASSERT_EQUAL(&FollowPath(snapshot, { "cache"s, "head"s, "next"s, "next"s }), &head);
+            const HeapNode& text = FollowPath(snapshot, { "cache"s, "head"s, "value"s });
+            ASSERT_EQUAL(text.type, "String"s);
+            ASSERT(text.shallow_size > 70);
+        }
+
+        void TestRetainedSizeFollowsDominators() {
+            const HeapSnapshot snapshot = TakeSnapshot(PROGRAM);
+            const HeapNode& head = FollowPath(snapshot, { "cache"s, "head"s });
+            const HeapNode& tail = FollowPath(snapshot, { "cache"s, "head"s, "next"s });
+            const HeapNode& shared = FollowPath(snapshot, { "shared"s });
+            const HeapNode& cache = FollowPath(snapshot, { "cache"s });
+
+            //     cache.head,  head  tail   
+            ASSERT_EQUAL(head.retained_size, head.shallow_size + tail.retained_size
+                + FollowPath(snapshot, { "cache"s, "head"s, "value"s }).shallow_size);
+            ASSERT(tail.retained_size < head.retained_size);
+            // shared     ,  cache   
+            ASSERT_EQUAL(cache.retained_size, cache.shallow_size + head.retained_size
+                + FollowPath(snapshot, { "cache"s, "size"s }).retained_size);
+            ASSERT(shared.retained_size > shared.shallow_size);
+
+            uint64_t total = 0;
+            for (size_t i = 1; i < snapshot.GetNodes().size(); ++i) {
+                total += snapshot.GetNodes()[i].shallow_size;
+            }
+            ASSERT_EQUAL(snapshot.GetTotalSize(), total);
+        }
+
+        void TestSnapshotRoundTripAndReport() {
+            const HeapSnapshot snapshot = TakeSnapshot(PROGRAM);
+            stringstream file;
+            snapshot.Write(file);
+            const HeapSnapshot loaded = HeapSnapshot::Read(file);
+            ASSERT_EQUAL(loaded.GetNodes().size(), snapshot.GetNodes().size());
+            for (size_t i = 0; i < loaded.GetNodes().size(); ++i) {
+                const HeapNode& lhs = loaded.GetNodes()[i];
+                const HeapNode& rhs = snapshot.GetNodes()[i];
+                ASSERT_EQUAL(lhs.type, rhs.type);
+                ASSERT_EQUAL(lhs.class_name, rhs.class_name);
+                ASSERT_EQUAL(lhs.retained_size, rhs.retained_size);
+                ASSERT_EQUAL(lhs.edges.size(), rhs.edges.size());
+            }
+
+            const auto top = FindTopRetainers(loaded, 2);
+            ASSERT_EQUAL(top.size(), 2u);
+            ASSERT_EQUAL(top[0].path, "cache"s);
+            ASSERT_EQUAL(top[1].path, "cache.head"s);
+
+            ostringstream report;
+            PrintHeapReport(report, loaded, 3);
+            ASSERT(report.str().find("Instance Node"s) != string::npos);
+            ASSERT(report.str().find("cache.head (Instance Node)"s) != string::npos);
+
+            istringstream garbage("not a snapshot"s);
+            ASSERT_THROWS(HeapSnapshot::Read(garbage), runtime_error);
+        }
+
+        void TestDamagedSnapshotIsRejected() {
+            stringstream file;
+            TakeSnapshot(PROGRAM).Write(file);
+            const string data = file.str();
+
+            // ,    
+            for (size_t size = 0; size < data.size(); ++size) {
+                istringstream truncated(data.substr(0, size));
+                ASSERT_THROWS(HeapSnapshot::Read(truncated), runtime_error);
+            }
+
+            //   ,     
+            string huge_count = data.substr(0, 5);
+            huge_count += "\xFF\xFF\xFF\xFF\x0F"s;
+            istringstream damaged(huge_count + data.substr(6));
+            ASSERT_THROWS(HeapSnapshot::Read(damaged), runtime_error);
+
+            //  ,      2^32 + 1,     32     1
+            string far_edge = data.substr(0, 5);
+            far_edge += "\x01\x01x\x02"s;
+            far_edge += "\x00\x00\x00\x00\x01\x00\x81\x80\x80\x80\x10"s;
+            far_edge += "\x00\x00\x00\x00\x00"s;
+            istringstream far_edge_stream(far_edge);
+            ASSERT_THROWS(HeapSnapshot::Read(far_edge_stream), runtime_error);
+        }
+
+    }  // namespace
+
+    void RunHeapSnapshotTests(TestRunner& tr) {
+        RUN_TEST(tr, TestSnapshotDescribesObjectGraph);
+        RUN_TEST(tr, TestRetainedSizeFollowsDominators);
+        RUN_TEST(tr, TestSnapshotRoundTripAndReport);
+        RUN_TEST(tr, TestDamagedSnapshotIsRejected);
+    }
+
+}  // namespace runtime
@@ -0,0 +1,372 @@
+#include "interpreter.h"
+#include "lexer.h"
+#include "runtime.h"
+#include "statement.h"
+
+#include "test_runner_p.h"
+
+#include <sstream>
+#include <thread>
+
+using namespace std;
+
+namespace {
+
+    void TestSimplePrints() {
+        istringstream input(R"(
+print 57
+print 10, 24, -8
+print 'hello'
+print "world"
+print True, False
+print
+print None
+)");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(), "57\n10 24 -8\nhello\nworld\nTrue False\n\nNone\n");
+    }
+
+    void TestAssignments() {
+        istringstream input(R"(
+x = 57
+print x
+x = 'C++ black belt'
+print x
+y = False
+x = y
+print x
+x = None
+print x, y
+)");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(), "57\nC++ black belt\nFalse\nNone False\n");
+    }
+
+    void TestArithmetics() {
+        istringstream input("print 1+2+3+4+5, 1*2*3*4*5, 1-2-3-4-5, 36/4/3, 2*5+10/2");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(), "15 120 -13 3 15\n");
+    }
+
+    void TestLargeIntegers() {
+        istringstream input(R"(
+balance = 3000000000
+print balance * 4
+big = balance * balance * balance
+print big, big / balance / balance
+print big - big + 1, big > balance, big == big
+print str(big) + '!'
+)");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(), "12000000000\n27000000000000000000000000000 3000000000\n1 True True\n27000000000000000000000000000!\n");
+    }
+
+    void TestMethodReturnsIntegers() {
+        istringstream input(R"(
+class Power:
+  def of(base, n):
+    result = 1
+    for i in range(n):
+      result = result * base
+    return result
+
+p = Power()
+y = p.of(2, 10)
+big = p.of(2, 70)
+print y + 1, big + 1, big / p.of(2, 69) - y
+)");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(), "1025 1180591620717411303425 -1022\n"s);
+    }
+
+    void TestFloats() {
+        istringstream input(R"(
+price = 19.99
+count = 3
+print price * count, count / 2, count / 2.0, 0.1 + 0.2
+print 1.0, -2.5, 1e21, 1.5e-7, price > 19
+print str(price) + ' EUR'
+)");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(), "59.97 1 1.5 0.30000000000000004\n1.0 -2.5 1e+21 1.5e-07 True\n19.99 EUR\n");
+    }
+
+    void TestMethodReturnsFloat() {
+        istringstream input(R"(
+class Circle:
+  def __init__(r):
+    self.r = r
+
+  def area():
+    return 3.0 * self.r * self.r
+
+c = Circle(0.5)
+d = Circle(2)
+y = c.area()
+print y + 1, y * 4 == 3.0, d.area() > 10
+)");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(), "1.75 True True\n"s);
+    }
+
+    void TestLists() {
+        istringstream input(R"(
+class Point:
+  def __init__(x):
+    self.x = x
+
+  def __str__():
+    return 'P' + str(self.x)
+
+numbers = [5, 3, 9]
+numbers.append(-1)
+numbers[0] = 4
+print numbers, len(numbers), numbers[1], numbers[-1]
+print sum(numbers), min(numbers), max(numbers)
+numbers.sort()
+print numbers, len([]), len('abc')
+mixed = [1, 'a', None, Point(2)]
+mixed[0] = [1.5, 2]
+print mixed, mixed[0][1], mixed[-1]
+print sum([9223372036854775807, 1]), sum([1, 2.5]), max(['b', 'c', 'a'])
+grid = [[0, 0], [0, 0]]
+grid[1][0] = 7
+print grid, [1, 2] == [1, 2], [1] == [2]
+)");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(),
+            "[4, 3, 9, -1] 4 3 -1\n"
+            "15 -1 9\n"
+            "[-1, 3, 4, 9] 0 3\n"
+            "[[1.5, 2], 'a', None, P2] 2 P2\n"
+            "9223372036854775808 3.5 c\n"
+            "[[0, 0], [7, 0]] True False\n");
+    }
+
+    void TestMethodReturnsList() {
+        istringstream input(R"(
+class Range:
+  def make(n):
+    items = []
+    for i in range(n):
+      items.append(i * i)
+    return items
+
+r = Range()
+squares = r.make(4)
+print squares, squares[3], r.make(3)[1], len(r.make(5))
+)");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(), "[0, 1, 4, 9] 9 1 5\n"s);
+    }
+
+    void TestDicts() {
+        istringstream input(R"(
+class Key:
+  def __init__(name):
+    self.name = name
+
+class Counter:
+  def __init__():
+    self.counts = {}
+
+  def add(word):
+    if word in self.counts:
+      self.counts[word] = self.counts[word] + 1
+    else:
+      self.counts[word] = 1
+
+ages = {'bob': 30, 'amy': 25}
+ages['eve'] = 41
+ages['bob'] = 31
+print ages, len(ages), ages['amy']
+print 'amy' in ages, 'zed' in ages, 'zed' not in ages
+print ages.get('zed'), ages.get('zed', 0), ages.pop('amy'), ages
+print ages.keys(), ages.values(), {} == {}, {1: 2} == {1.0: 2}
+mixed = {1: 'one', 2.5: None, True: [1, 2]}
+print mixed[1.0], mixed, 3 in [1, 2, 3], 'ell' in 'hello'
+k = Key('a')
+objects = {k: 1}
+print objects[k], Key('a') in objects
+counter = Counter()
+counter.add('a')
+counter.add('b')
+counter.add('a')
+print counter.counts
+)");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(),
+            "{'bob': 31, 'amy': 25, 'eve': 41} 3 25\n"
+            "True False True\n"
+            "None 0 25 {'bob': 31, 'eve': 41}\n"
+            "['bob', 'eve'] [31, 41] True True\n"
+            "one {1: 'one', 2.5: None, True: [1, 2]} True True\n"
+            "1 False\n"
+            "{'a': 2, 'b': 1}\n");
+    }
+
+    void TestUserDefinedDictKeys() {
+        istringstream input(R"(
+class K:
+  def __init__(x):
+    self.x = x
+
+  def __hash__():
+    return self.x
+
+  def __eq__(rhs):
+    return self.x == rhs.x
+
+d = {}
+d[K(1)] = 'a'
+d[K(1)] = 'b'
+d[K(2)] = 'c'
+print len(d), d[K(1)], K(2) in d, K(3) in d
+)");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(), "2 b True False\n"s);
+    }
+
+    void TestVariablesArePointers() {
+        istringstream input(R"(
+class Counter:
+  def __init__():
+    self.value = 0
+
+  def add():
+    self.value = self.value + 1
+
+class Dummy:
+  def do_add(counter):
+    counter.add()
+
+x = Counter()
+y = x
+
+x.add()
+y.add()
+
+print x.value
+
+d = Dummy()
+d.do_add(x)
+
+print y.value
+)");
+
+        ostringstream output;
+        RunMythonProgram(input, output);
+
+        ASSERT_EQUAL(output.str(), "2\n3\n");
+    }
+
+    void TestProgramIsReentrant() {
+        istringstream input(R"(
+class Counter:
+  def __init__(start):
+    self.value = start
+
+  def add():
+    self.value = self.value + 1
+
+class Pair:
+  def __init__():
+    self.first = Counter(0)
+    self.second = Counter(10)
+
+  def step():
+    self.first.add()
+    self.second.add()
+
+  def __str__():
+    return str(self.first.value) + ':' + str(self.second.value)
+
+p = Pair()
+q = Pair()
+p.step()
+p.step()
+q.step()
+print p, q
+)");
+        parse::Lexer lexer(input);
+        const auto program = ParseProgram(lexer);
+
+        const string expected = "2:12 1:11\n"s;
+        for (int run = 0; run < 3; ++run) {
+            runtime::DummyContext context;
+            runtime::Closure closure;
+            program->Execute(closure, context);
+            ASSERT_EQUAL(context.output.str(), expected);
+        }
+
+        const int thread_count = 8;
+        vector<string> outputs(thread_count);
+        vector<thread> threads;
+        for (int i = 0; i < thread_count; ++i) {
+            threads.emplace_back([&program, &outputs, i]() {
+                for (int run = 0; run < 50; ++run) {
+                    runtime::DummyContext context;
+                    runtime::Closure closure;
+                    program->Execute(closure, context);
+                    outputs[i] = context.output.str();
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        for (const auto& output : outputs) {
+            ASSERT_EQUAL(output, expected);
+        }
+    }
+
+}  // namespace
+
+void RunInterpreterTests(TestRunner& tr) {
+    RUN_TEST(tr, TestSimplePrints);
+    RUN_TEST(tr, TestAssignments);
+    RUN_TEST(tr, TestArithmetics);
+    RUN_TEST(tr, TestLargeIntegers);
+    RUN_TEST(tr, TestMethodReturnsIntegers);
+    RUN_TEST(tr, TestFloats);
+    RUN_TEST(tr, TestMethodReturnsFloat);
+    RUN_TEST(tr, TestLists);
+    RUN_TEST(tr, TestMethodReturnsList);
+    RUN_TEST(tr, TestDicts);
+    RUN_TEST(tr, TestUserDefinedDictKeys);
+    RUN_TEST(tr, TestVariablesArePointers);
+    RUN_TEST(tr, TestProgramIsReentrant);
+}
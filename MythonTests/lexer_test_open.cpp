@@ -23,7 +23,7 @@ namespace parse {
         }
 
         void TestKeywords() {
-            istringstream input("class return if else def print or None and not True False"s);
+            istringstream input("class return if else def print or None and not True False in while for break continue"s);
             Lexer lexer(input);
 
             ASSERT_EQUAL(lexer.CurrentToken(), Token(token_type::Class{}));
@@ -38,6 +38,11 @@ namespace parse {
             ASSERT_EQUAL(lexer.NextToken(), Token(token_type::Not{}));
             ASSERT_EQUAL(lexer.NextToken(), Token(token_type::True{}));
             ASSERT_EQUAL(lexer.NextToken(), Token(token_type::False{}));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::In{}));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::While{}));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::For{}));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::Break{}));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::Continue{}));
         }
 
         void TestNumbers() {
@@ -51,6 +56,23 @@ namespace parse {
             ASSERT_EQUAL(lexer.NextToken(), Token(token_type::Number{ 53 }));
         }
 
+        void TestFloats() {
+            istringstream input("1.5 0.25 2. 1e3 1.5e-3 2E+2 7.x\n"s);
+            Lexer lexer(input);
+
+            ASSERT_EQUAL(lexer.CurrentToken(), Token(token_type::Float{ 1.5 }));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::Float{ 0.25 }));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::Float{ 2.0 }));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::Float{ 1000.0 }));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::Float{ 0.0015 }));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::Float{ 200.0 }));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::Float{ 7.0 }));
+            ASSERT_EQUAL(lexer.NextToken(), Token(token_type::Id{ "x"s }));
+
+            istringstream bad("1e\n"s);
+            ASSERT_THROWS(Lexer{ bad }, LexerError);
+        }
+
         void TestIds() {
             istringstream input("x    _42 big_number   Return Class  dEf"s);
             Lexer lexer(input);
@@ -357,6 +379,7 @@ abc#
         RUN_TEST(tr, parse::TestSimpleAssignment);
         RUN_TEST(tr, parse::TestKeywords);
         RUN_TEST(tr, parse::TestNumbers);
+        RUN_TEST(tr, parse::TestFloats);
         RUN_TEST(tr, parse::TestIds);
         RUN_TEST(tr, parse::TestStrings);
         RUN_TEST(tr, parse::TestOperations);
@@ -0,0 +1,186 @@
+#include "lexer.h"
+#include "memory_account.h"
+#include "parse.h"
+#include "statement.h"
+
+#include "test_runner_p.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace runtime {
+
+    namespace {
+
+        void RunProgram(const string& source, Closure& closure, Context& context) {
+            istringstream input(source);
+            parse::Lexer lexer(input);
+            auto program = ParseProgram(lexer);
+            program->Execute(closure, context);
+        }
+
+        void TestAccountCountsAndLimits() {
+            MemoryAccount account(1000);
+            account.Allocate(MemoryKind::String, 600);
+            account.Allocate(MemoryKind::Number, 100);
+            ASSERT_THROWS(account.Allocate(MemoryKind::String, 301), MemoryLimitExceeded);
+            ASSERT_THROWS(account.CheckAvailable(301), MemoryLimitExceeded);
+            account.CheckAvailable(300);
+            account.Release(MemoryKind::String, 600);
+            account.Allocate(MemoryKind::Instance, 800);
+
+            const MemoryStats stats = account.GetStats();
+            ASSERT_EQUAL(stats.live_bytes, 900u);
+            ASSERT_EQUAL(stats.peak_bytes, 900u);
+            //    
+            ASSERT_EQUAL(stats.allocations, 3u);
+            ASSERT_EQUAL(stats[MemoryKind::String].allocations, 1u);
+            ASSERT_EQUAL(stats[MemoryKind::String].live_bytes, 0u);
+            ASSERT_EQUAL(stats[MemoryKind::Instance].live_bytes, 800u);
+        }
+
+        void TestChargeCopyUsesCurrentAccount() {
+            auto original_account = make_shared<MemoryAccount>();
+            auto copy_account = make_shared<MemoryAccount>();
+            {
+                const MemoryAccount::Scope original_scope(original_account);
+                MemoryCharge original(MemoryKind::List);
+                original.Add(100);
+                {
+                    const MemoryAccount::Scope copy_scope(copy_account);
+                    MemoryCharge copy(original);
+                    copy.Add(40);
+                    ASSERT_EQUAL(copy_account->GetStats()[MemoryKind::List].live_bytes, 40u);
+                }
+                ASSERT_EQUAL(original_account->GetStats().live_bytes, 100u);
+                ASSERT_EQUAL(copy_account->GetStats().live_bytes, 0u);
+            }
+            ASSERT_EQUAL(original_account->GetStats().live_bytes, 0u);
+        }
+
+        void TestExecutionIsAccountedByKind() {
+            auto account = make_shared<MemoryAccount>();
+            ostringstream output;
+            SimpleContext context{ output };
+            {
+                const MemoryAccount::Scope scope(account);
+                Closure closure;
+                const ClosureCharge closure_charge(closure);
+                RunProgram(R"(
+class Point:
+  def __init__(x, y):
+    self.x = x
+    self.y = y
+
+  def shift(dx):
+    moved = self.x + dx
+    self.x = moved
+
+p = Point(1, 2)
+p.shift(5)
+name = 'a rather long string that does not fit into the short string buffer'
+ok = p.x > 3
+print p.x, ok
+)"s, closure, context);
+                ASSERT_EQUAL(output.str(), "6 True\n"s);
+
+                const MemoryStats stats = account->GetStats();
+                ASSERT_EQUAL(stats[MemoryKind::Instance].allocations, 1u);
+                ASSERT(stats[MemoryKind::Number].allocations >= 3);
+                ASSERT_EQUAL(stats[MemoryKind::Bool].allocations, 1u);
+                ASSERT(stats[MemoryKind::String].live_bytes > 70);
+                //  ;     ,   
+                //   
+                ASSERT_EQUAL(stats[MemoryKind::Closure].live_bytes,
+                    GetClosureEntryBytes("Point"s) + GetClosureEntryBytes("p"s) + GetClosureEntryBytes("name"s)
+                    + GetClosureEntryBytes("ok"s));
+                ASSERT(stats.peak_bytes >= stats.live_bytes);
+            }
+            // ,   ,     
+            ASSERT_EQUAL(account->GetStats().live_bytes, 0u);
+        }
+
+        void TestLimitAbortsExecutionCleanly() {
+            auto account = make_shared<MemoryAccount>(64 * 1024);
+            ostringstream output;
+            SimpleContext context{ output };
+            {
+                const MemoryAccount::Scope scope(account);
+                Closure closure;
+                const ClosureCharge closure_charge(closure);
+                //   :      self  
+                ASSERT_THROWS(RunProgram(R"(
+class Chain:
+  def grow(n):
+    self.last = n
+    self.grow(n + 1)
+
+c = Chain()
+print 'start'
+c.grow(0)
+print 'unreachable'
+)"s, closure, context), MemoryLimitExceeded);
+                ASSERT_EQUAL(output.str(), "start\n"s);
+                ASSERT(account->GetStats().peak_bytes <= 64 * 1024);
+            }
+            ASSERT_EQUAL(account->GetStats().live_bytes, 0u);
+        }
+
+        void TestLazyMethodBodyIsNotCharged() {
+            istringstream input(R"(
+class Greeter:
+  def greet():
+    return 'a rather long string that does not fit into the short string buffer'
+
+g = Greeter()
+text = g.greet()
+)"s);
+            parse::Lexer lexer(input);
+            const auto program = ParseProgram(lexer, MethodParsing::Lazy);
+
+            auto account = make_shared<MemoryAccount>();
+            ostringstream output;
+            SimpleContext context{ output };
+            {
+                const MemoryAccount::Scope scope(account);
+                Closure closure;
+                const ClosureCharge closure_charge(closure);
+                program->Execute(closure, context);
+            }
+            //         ,    
+            ASSERT_EQUAL(account->GetStats().live_bytes, 0u);
+        }
+
+        void TestSharedStrResultsAreNotCharged() {
+            auto account = make_shared<MemoryAccount>();
+            ostringstream output;
+            SimpleContext context{ output };
+            {
+                const MemoryAccount::Scope scope(account);
+                Closure closure;
+                const ClosureCharge closure_charge(closure);
+                RunProgram(R"(
+x = str(None)
+y = str(True)
+z = str(False)
+)"s, closure, context);
+            }
+            //   str        
+            ASSERT_EQUAL(account->GetStats().live_bytes, 0u);
+        }
+
+    }  // namespace
+
+    void RunMemoryAccountTests(TestRunner& tr) {
+        RUN_TEST(tr, TestAccountCountsAndLimits);
+        RUN_TEST(tr, TestChargeCopyUsesCurrentAccount);
+        RUN_TEST(tr, TestExecutionIsAccountedByKind);
+        RUN_TEST(tr, TestLimitAbortsExecutionCleanly);
+        RUN_TEST(tr, TestLazyMethodBodyIsNotCharged);
+        RUN_TEST(tr, TestSharedStrResultsAreNotCharged);
+    }
+
+}  // namespace runtime
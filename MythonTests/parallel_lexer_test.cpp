@@ -0,0 +1,106 @@
+#include "parallel_lexer.h"
+#include "parse.h"
+#include "runtime.h"
+#include "statement.h"
+
+#include "test_runner_p.h"
+
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace parse {
+
+    namespace {
+        const string PROGRAM_PART = R"(
+class Counter{0}:
+  def __init__():
+    self.value = 0
+
+  def add(delta):
+    if delta > 0:
+      self.value = self.value + delta
+    else:
+      self.value = self.value - delta
+    return self.value
+
+c{0} = Counter{0}()
+# top level comment
+c{0}.add(2)
+if c{0}.value == 2:
+  print 'ok', c{0}.value
+else:
+  print "fail"
+x = 1 + 2 * 3
+print x, str(x), None
+)"s;
+
+        string MakeProgram(int parts) {
+            string program;
+            for (int i = 0; i < parts; ++i) {
+                string part = PROGRAM_PART;
+                const string id = to_string(i);
+                for (size_t pos = part.find("{0}"s); pos != string::npos; pos = part.find("{0}"s, pos)) {
+                    part.replace(pos, 3, id);
+                }
+                program += part;
+            }
+            return program;
+        }
+
+        void TestSplitAtTopLevel() {
+            const string program = "x = 1\nif x:\n  y = 2\nelse:\n  y = 3\n# comment\n\nz = 4\n"s;
+            const auto starts = SplitAtTopLevel(program, 100, 1);
+
+            ASSERT_EQUAL(starts.front(), 0u);
+            for (size_t start : starts) {
+                ASSERT(start == 0 || program[start - 1] == '\n');
+                ASSERT(program[start] != ' ' && program[start] != '#');
+                ASSERT(program.compare(start, 4, "else"s) != 0);
+            }
+            ASSERT_EQUAL(starts, (vector<size_t>{ 0, program.find("if"s), program.find("z = 4"s) }));
+            ASSERT_EQUAL(SplitAtTopLevel(program, 1, 1), vector<size_t>{ 0 });
+        }
+
+        void TestParallelTokensMatchSerial() {
+            const string program = MakeProgram(50);
+
+            istringstream input(program);
+            const vector<Token> serial = Tokenize(input);
+
+            for (size_t threads : { 1, 2, 3, 8 }) {
+                const vector<Token> parallel = TokenizeParallel(program, threads, 16);
+                ASSERT_EQUAL(parallel.size(), serial.size());
+                ASSERT(parallel == serial);
+            }
+            ASSERT(TokenizeParallel(program, 4) == serial);
+            ASSERT(TokenizeParallel(""s, 4, 1) == vector<Token>{ token_type::Eof{} });
+        }
+
+        void TestReplayedTokensAreParsed() {
+            const string program = MakeProgram(10);
+
+            istringstream input(program);
+            Lexer serial_lexer(input);
+            runtime::DummyContext serial_context;
+            runtime::Closure serial_closure;
+            ParseProgram(serial_lexer)->Execute(serial_closure, serial_context);
+
+            Lexer replay_lexer(TokenizeParallel(program, 4, 16));
+            runtime::DummyContext context;
+            runtime::Closure closure;
+            ParseProgram(replay_lexer)->Execute(closure, context);
+
+            ASSERT_EQUAL(context.output.str(), serial_context.output.str());
+            ASSERT(!context.output.str().empty());
+        }
+    }  // namespace
+
+    void RunParallelLexerTests(TestRunner& tr) {
+        RUN_TEST(tr, parse::TestSplitAtTopLevel);
+        RUN_TEST(tr, parse::TestParallelTokensMatchSerial);
+        RUN_TEST(tr, parse::TestReplayedTokensAreParsed);
+    }
+
+}  // namespace parse
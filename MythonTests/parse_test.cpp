@@ -1,4 +1,5 @@
 #include "lexer.h"
+#include "parallel_lexer.h"
 #include "parse.h"
 #include "statement.h"
 
@@ -8,10 +9,11 @@ using namespace std;
 
 namespace parse {
 
-    unique_ptr<ast::Statement> ParseProgramFromString(const string& program) {
+    unique_ptr<ast::Statement> ParseProgramFromString(const string& program,
+        MethodParsing method_parsing = MethodParsing::Eager) {
         istringstream is(program);
         parse::Lexer lexer(is);
-        return ParseProgram(lexer);
+        return ParseProgram(lexer, method_parsing);
     }
 
     void TestSimpleProgram() {
@@ -245,6 +247,146 @@ print r, c, t1, t2
             "Rect(10x20) Circle(52) Triangle(3, 4, 5) Wrong triangle\n"s);
     }
 
+    void TestLazyMethodParsing() {
+        const string program = R"(
+class GCD:
+  def __init__():
+    self.call_count = 0
+
+  def calc(a, b):
+    self.call_count = self.call_count + 1
+    if a < b:
+      return self.calc(b, a)
+    if b == 0:
+      return a
+    return self.calc(a - b, b)
+
+class Counter(GCD):
+  def __str__():
+    return 'Counter(' + str(self.call_count) + ')'
+
+x = Counter()
+print x.calc(510510, 18629977)
+print x, x.call_count + 1
+)"s;
+
+        string outputs[2];
+        for (auto method_parsing : { MethodParsing::Eager, MethodParsing::Lazy }) {
+            runtime::DummyContext context;
+            runtime::Closure closure;
+            auto tree = ParseProgramFromString(program, method_parsing);
+            tree->Execute(closure, context);
+            outputs[static_cast<int>(method_parsing)] = context.output.str();
+        }
+
+        ASSERT_EQUAL(outputs[0], "17\nCounter(102) 103\n"s);
+        ASSERT_EQUAL(outputs[1], outputs[0]);
+
+        parse::Lexer replay_lexer(TokenizeParallel(program, 2, 1));
+        runtime::DummyContext context;
+        runtime::Closure closure;
+        ParseProgram(replay_lexer, MethodParsing::Lazy)->Execute(closure, context);
+        ASSERT_EQUAL(context.output.str(), outputs[0]);
+    }
+
+    void TestLazyMethodParsingDefersErrors() {
+        const string program = R"(
+class Broken:
+  def ok():
+    print 'ok'
+
+  def broken():
+    x = = 1
+
+b = Broken()
+b.ok()
+)"s;
+
+        ASSERT_THROWS(ParseProgramFromString(program), std::exception);
+
+        runtime::DummyContext context;
+        runtime::Closure closure;
+        auto tree = ParseProgramFromString(program, MethodParsing::Lazy);
+        tree->Execute(closure, context);
+        ASSERT_EQUAL(context.output.str(), "ok\n"s);
+
+        auto call_broken = ParseProgramFromString(program + "b.broken()\n"s, MethodParsing::Lazy);
+        ASSERT_THROWS(call_broken->Execute(closure, context), std::exception);
+    }
+
+    void TestLoops() {
+        const string program = R"(
+class Counter:
+  def __init__():
+    self.value = 0
+
+  def count_to(n):
+    while self.value < n:
+      self.value = self.value + 1
+
+total = 0
+for i in range(10):
+  if i == 7:
+    break
+  if i == 2:
+    continue
+  total = total + i
+print total, i
+for i in range(10, 0, -4):
+  print i
+for i in range(3, 3):
+  print 'never'
+c = Counter()
+c.count_to(5)
+print c.value
+for x in [1, 'a', [2]]:
+  for y in {'k': 1}:
+    print x, y
+)"s;
+
+        runtime::DummyContext context;
+        runtime::Closure closure;
+        ParseProgramFromString(program)->Execute(closure, context);
+        ASSERT_EQUAL(context.output.str(), "19 7\n10\n6\n2\n5\n1 k\na k\n[2] k\n"s);
+    }
+
+    void TestBreakOutsideLoop() {
+        ASSERT_THROWS(ParseProgramFromString("break\n"s), ParseError);
+        ASSERT_THROWS(ParseProgramFromString("if True:\n  continue\n"s), ParseError);
+        // Метод класса, объявленного в цикле, не находится внутри этого цикла
+        const string program = "while False:\n  class A:\n    def f():\n      break\n"s;
+        ASSERT_THROWS(ParseProgramFromString(program), ParseError);
+        ParseProgramFromString("for i in range(2):\n  if i:\n    break\n"s);
+    }
+
+    void TestReturnFromLoop() {
+        const string program = R"(
+class Finder:
+  def find(items, x):
+    for i in range(len(items)):
+      while True:
+        if items[i] == x:
+          return i
+        break
+    return -1
+
+f = Finder()
+print f.find([5, 7, 9], 9), f.find([5, 7], 1), f.find([3], 3) + 1
+)"s;
+
+        runtime::DummyContext context;
+        runtime::Closure closure;
+        ParseProgramFromString(program)->Execute(closure, context);
+
+        ASSERT_EQUAL(context.output.str(), "2 -1 1\n"s);
+    }
+
+    void TestReturnOutsideMethod() {
+        ASSERT_THROWS(ParseProgramFromString("return 1\n"s), ParseError);
+        ASSERT_THROWS(ParseProgramFromString("for i in range(2):\n  return i\n"s), ParseError);
+        ParseProgramFromString("class A:\n  def f():\n    while True:\n      return 1\n"s);
+    }
+
 }  // namespace parse
 
 void TestParseProgram(TestRunner& tr) {
@@ -256,4 +398,10 @@ void TestParseProgram(TestRunner& tr) {
     RUN_TEST(tr, parse::TestRecursion2);
     RUN_TEST(tr, parse::TestComplexLogicalExpression);
     RUN_TEST(tr, parse::TestClassicalPolymorphism);
+    RUN_TEST(tr, parse::TestLazyMethodParsing);
+    RUN_TEST(tr, parse::TestLazyMethodParsingDefersErrors);
+    RUN_TEST(tr, parse::TestLoops);
+    RUN_TEST(tr, parse::TestBreakOutsideLoop);
+    RUN_TEST(tr, parse::TestReturnFromLoop);
+    RUN_TEST(tr, parse::TestReturnOutsideMethod);
 }
\ No newline at end of file
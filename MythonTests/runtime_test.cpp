@@ -1,6 +1,9 @@
+#include "dict.h"
 #include "runtime.h"
 
 #include <functional>
+#include <stdexcept>
+#include <thread>
 #include "test_runner_p.h"
 
 using namespace std;
@@ -62,6 +65,28 @@ namespace runtime {
             ASSERT_EQUAL(num.GetValue(), 127);
         }
 
+        void TestFloat() {
+            DummyContext context;
+            Float(0.1).Print(context.output, context);
+            ASSERT_EQUAL(context.output.str(), "0.1"s);
+
+            const auto render = [&context](double value) {
+                string out;
+                Float(value).Render(out, context);
+                return out;
+            };
+            ASSERT_EQUAL(render(2.0), "2.0"s);
+            ASSERT_EQUAL(render(-0.0), "-0.0"s);
+            ASSERT_EQUAL(render(1e300), "1e+300"s);
+            ASSERT_EQUAL(render(numeric_limits<double>::infinity()), "inf"s);
+            ASSERT_EQUAL(render(numeric_limits<double>::quiet_NaN()), "nan"s);
+
+            //         
+            for (double value : { 0.1 + 0.2, 1.0 / 3.0, 123456789.125, -2.2250738585072014e-308 }) {
+                ASSERT_EQUAL(stod(render(value)), value);
+            }
+        }
+
         void TestString() {
             String word("hello!"s);
 
@@ -529,10 +554,295 @@ namespace runtime {
             ASSERT_THROWS(instance.Call("missing_method"s, {}, ctx), runtime_error);
         }
 
+        void TestExecutionBudget() {
+            ExecutionBudget budget(10);
+            budget.SetSlice(3);
+            budget.Charge(3);
+            ASSERT(!budget.IsPreemptionRequested());
+            budget.Charge(1);
+            //     
+            ASSERT(budget.IsPreemptionRequested());
+            budget.SetSlice(100);
+            ASSERT(!budget.IsPreemptionRequested());
+            budget.Charge(6);
+            ASSERT_EQUAL(budget.GetUsed(), 10u);
+            ASSERT_THROWS(budget.Charge(1), FuelExhausted);
+
+            //     
+            Class cls{ "Empty"s, {}, nullptr };
+            ClassInstance instance{ cls };
+            DummyContext ctx;
+            ExecutionBudget call_budget;
+            ctx.SetBudget(&call_budget);
+            ASSERT_THROWS(instance.Call("missing_method"s, {}, ctx), runtime_error);
+            ASSERT_EQUAL(call_budget.GetUsed(), 1u);
+        }
+
+        void TestFieldMapSwitchesToIndex() {
+            FieldMap fields;
+            ASSERT(fields.empty());
+            for (int i = 0; i < 4; ++i) {
+                fields["f"s + std::to_string(i)] = ObjectHolder::Own(Number(i));
+            }
+            //     
+            ASSERT_EQUAL(fields.GetStorageBytes(), 0u);
+
+            for (int i = 4; i < 100; ++i) {
+                ASSERT(fields.try_emplace("f"s + std::to_string(i)).second);
+                fields.at("f"s + std::to_string(i)) = ObjectHolder::Own(Number(i));
+            }
+            ASSERT(fields.GetStorageBytes() > 0);
+            ASSERT_EQUAL(fields.size(), 100u);
+            ASSERT(!fields.emplace("f7"s, ObjectHolder::None()).second);
+            for (int i = 0; i < 100; ++i) {
+                const auto it = fields.find("f"s + std::to_string(i));
+                ASSERT(it != fields.end());
+                ASSERT_EQUAL(it->second.TryAs<Number>()->GetValue(), i);
+            }
+            ASSERT_EQUAL(fields.count("f100"s), 0u);
+            ASSERT_THROWS((void)fields.at("f100"s), std::out_of_range);
+
+            //      
+            fields.erase(fields.find("f0"s));
+            ASSERT_EQUAL(fields.count("f0"s), 0u);
+            int expected = 1;
+            for (const auto& [name, value] : fields) {
+                ASSERT_EQUAL(name, "f"s + std::to_string(expected));
+                ASSERT_EQUAL(value.TryAs<Number>()->GetValue(), expected);
+                ++expected;
+            }
+            ASSERT_EQUAL(fields.find("f99"s)->second.TryAs<Number>()->GetValue(), 99);
+        }
+
+        void TestFieldMapCopyAndSwap() {
+            FieldMap small;
+            small["x"s] = ObjectHolder::Own(Number(1));
+            FieldMap large;
+            for (int i = 0; i < 20; ++i) {
+                large["f"s + std::to_string(i)] = ObjectHolder::Own(Number(i));
+            }
+
+            FieldMap copy = large;
+            ASSERT_EQUAL(copy.size(), 20u);
+            ASSERT_EQUAL(copy.at("f19"s).Get(), large.at("f19"s).Get());
+
+            small.swap(large);
+            ASSERT_EQUAL(small.size(), 20u);
+            ASSERT_EQUAL(large.size(), 1u);
+            ASSERT_EQUAL(small.at("f3"s).TryAs<Number>()->GetValue(), 3);
+            ASSERT_EQUAL(large.at("x"s).TryAs<Number>()->GetValue(), 1);
+
+            FieldMap moved = std::move(large);
+            ASSERT(large.empty());
+            ASSERT_EQUAL(moved.at("x"s).TryAs<Number>()->GetValue(), 1);
+            large = copy;
+            ASSERT_EQUAL(large.size(), 20u);
+        }
+
+        void TestListStoresIntegersUnboxed() {
+            DummyContext context;
+            List list;
+            for (int i = 5; i > 0; --i) {
+                list.Append(ObjectHolder::Own(Number(i)));
+            }
+            ASSERT(list.HoldsIntegers());
+            ASSERT(list.GetObjects().empty());
+            ASSERT_EQUAL(list.GetSize(), 5u);
+            ASSERT_EQUAL(list.GetItem(0).TryAs<Number>()->GetValue(), 5);
+            ASSERT_EQUAL(list.GetItem(-1).TryAs<Number>()->GetValue(), 1);
+            ASSERT_THROWS((void)list.GetItem(5), std::runtime_error);
+            ASSERT_THROWS((void)list.GetItem(-6), std::runtime_error);
+
+            ASSERT_EQUAL(list.SumIntegers().TryAs<Number>()->GetValue(), 15);
+            ASSERT_EQUAL(list.Min(context).TryAs<Number>()->GetValue(), 1);
+            ASSERT_EQUAL(list.Max(context).TryAs<Number>()->GetValue(), 5);
+            list.Sort(context);
+            ASSERT((list.GetIntegers() == std::vector<std::int64_t>{ 1, 2, 3, 4, 5 }));
+
+            //         
+            list.SetItem(1, ObjectHolder::Own(String("x"s)));
+            ASSERT(!list.HoldsIntegers());
+            ASSERT(list.GetIntegers().empty());
+            ASSERT_EQUAL(list.GetObjects().size(), 5u);
+            ASSERT_EQUAL(list.GetItem(0).TryAs<Number>()->GetValue(), 1);
+            list.Print(context.output, context);
+            ASSERT_EQUAL(context.output.str(), "[1, 'x', 3, 4, 5]"s);
+            ASSERT(IsTrue(ObjectHolder::Share(list)));
+            ASSERT(!IsTrue(ObjectHolder::Own(List())));
+        }
+
+        void TestListSumOverflowsIntoBigInteger() {
+            List list;
+            for (int i = 0; i < 3; ++i) {
+                list.Append(ObjectHolder::Own(Number(std::numeric_limits<std::int64_t>::max())));
+            }
+            list.Append(ObjectHolder::Own(Number(std::numeric_limits<std::int64_t>::min())));
+            const ObjectHolder sum = list.SumIntegers();
+            ASSERT(sum.TryAs<BigNumber>() != nullptr);
+            ASSERT_EQUAL(sum.TryAs<BigNumber>()->GetValue().ToString(), "18446744073709551613"s);
+
+            // ,     64 ,  Number
+            list.Append(ObjectHolder::Own(Number(std::numeric_limits<std::int64_t>::min())));
+            ASSERT_EQUAL(list.SumIntegers().TryAs<Number>()->GetValue(), std::numeric_limits<std::int64_t>::max() - 2);
+        }
+
+        void TestListSortKeepsItemsOnError() {
+            DummyContext context;
+            List list;
+            list.Append(ObjectHolder::Own(String("b"s)));
+            list.Append(ObjectHolder::Own(String("a"s)));
+            list.Sort(context);
+            ASSERT_EQUAL(list.GetItem(0).TryAs<String>()->GetValue(), "a"s);
+
+            list.Append(ObjectHolder::Own(Number(1)));
+            ASSERT_THROWS(list.Sort(context), std::runtime_error);
+            ASSERT_EQUAL(list.GetSize(), 3u);
+            ASSERT_EQUAL(list.GetItem(1).TryAs<String>()->GetValue(), "b"s);
+            ASSERT_EQUAL(list.GetItem(2).TryAs<Number>()->GetValue(), 1);
+        }
+
+        void TestDictGrowsAndErases() {
+            DummyContext context;
+            Dict dict;
+            for (int i = 0; i < 1000; ++i) {
+                dict.Set(ObjectHolder::Own(Number(i)), ObjectHolder::Own(Number(i * 2)), context);
+            }
+            dict.Set(ObjectHolder::Own(String("key"s)), ObjectHolder::Own(String("value"s)), context);
+            ASSERT_EQUAL(dict.GetSize(), 1001u);
+            ASSERT_EQUAL(dict.Get(ObjectHolder::Own(Number(500)), context).TryAs<Number>()->GetValue(), 1000);
+            //     -     
+            ASSERT_EQUAL(dict.Get(ObjectHolder::Own(Float(7.0)), context).TryAs<Number>()->GetValue(), 14);
+            ASSERT_EQUAL(dict.Get(ObjectHolder::Own(String("key"s)), context).TryAs<String>()->GetValue(), "value"s);
+            ASSERT(dict.Find(ObjectHolder::Own(Float(7.5)), context) == nullptr);
+            ASSERT(dict.Find(ObjectHolder::Own(String("7"s)), context) == nullptr);
+            ASSERT_THROWS((void)dict.Get(ObjectHolder::Own(Number(1000)), context), std::runtime_error);
+            ASSERT_THROWS(dict.Set(ObjectHolder::Own(List()), ObjectHolder::None(), context), std::runtime_error);
+
+            for (int i = 0; i < 1000; i += 2) {
+                ASSERT(dict.Erase(ObjectHolder::Own(Number(i)), context));
+            }
+            ASSERT(!dict.Erase(ObjectHolder::Own(Number(0)), context));
+            ASSERT_EQUAL(dict.GetSize(), 501u);
+            ASSERT(dict.Find(ObjectHolder::Own(Number(2)), context) == nullptr);
+            ASSERT_EQUAL(dict.Get(ObjectHolder::Own(Number(3)), context).TryAs<Number>()->GetValue(), 6);
+
+            //        
+            for (int i = 0; i < 4000; ++i) {
+                dict.Set(ObjectHolder::Own(Number(-i - 1)), ObjectHolder::None(), context);
+                dict.Erase(ObjectHolder::Own(Number(-i - 1)), context);
+            }
+            ASSERT_EQUAL(dict.GetSize(), 501u);
+            ASSERT(dict.GetEntries().size() < 4000u);
+            std::int64_t previous = -1;
+            for (const auto& entry : dict.GetEntries()) {
+                if (const auto* key = entry.key.TryAs<Number>(); key != nullptr && !entry.erased) {
+                    ASSERT(key->GetValue() > previous);
+                    previous = key->GetValue();
+                }
+            }
+
+            Dict small;
+            small.Set(ObjectHolder::Own(String("a"s)), ObjectHolder::Own(Number(1)), context);
+            small.Set(ObjectHolder::None(), ObjectHolder::Own(Bool(true)), context);
+            small.Print(context.output, context);
+            ASSERT_EQUAL(context.output.str(), "{'a': 1, None: True}"s);
+            ASSERT(IsTrue(ObjectHolder::Share(small)));
+            ASSERT(!IsTrue(ObjectHolder::Own(Dict())));
+        }
+
+        void TestDictUsesHashAndEqMethods() {
+            DummyContext context;
+            int hash_calls = 0;
+            int eq_calls = 0;
+            //       ,       __eq__
+            auto hash_body = [&hash_calls](Closure&, Context&) {
+                ++hash_calls;
+                return ObjectHolder::Own(Number(7));
+            };
+            auto eq_body = [&eq_calls](Closure& closure, Context&) {
+                ++eq_calls;
+                const auto* self = closure.at("self"s).TryAs<ClassInstance>();
+                const auto* rhs = closure.at("rhs"s).TryAs<ClassInstance>();
+                return ObjectHolder::Own(Bool(rhs != nullptr
+                    && self->Fields().at("id"s).TryAs<Number>()->GetValue()
+                        == rhs->Fields().at("id"s).TryAs<Number>()->GetValue()));
+            };
+            std::vector<Method> methods;
+            methods.push_back({ "__hash__"s, {}, make_unique<TestMethodBody>(hash_body) });
+            methods.push_back({ "__eq__"s, {"rhs"s}, make_unique<TestMethodBody>(eq_body) });
+            Class cls{ "Key"s, std::move(methods), nullptr };
+            const auto make_key = [&cls](int id) {
+                ObjectHolder key = ObjectHolder::Own(ClassInstance(cls));
+                key.TryAs<ClassInstance>()->SetField("id"s, ObjectHolder::Own(Number(id)));
+                return key;
+            };
+
+            Dict dict;
+            for (int i = 0; i < 40; ++i) {
+                dict.Set(make_key(i), ObjectHolder::Own(Number(i)), context);
+            }
+            ASSERT_EQUAL(dict.GetSize(), 40u);
+            ASSERT_EQUAL(hash_calls, 40);
+
+            eq_calls = 0;
+            ASSERT_EQUAL(dict.Get(make_key(39), context).TryAs<Number>()->GetValue(), 39);
+            ASSERT_EQUAL(eq_calls, 40);
+            ASSERT(dict.Find(make_key(40), context) == nullptr);
+            //   __hash__   
+            Class plain{ "Plain"s, {}, nullptr };
+            ObjectHolder key = ObjectHolder::Own(ClassInstance(plain));
+            dict.Set(key, ObjectHolder::None(), context);
+            ASSERT(dict.Find(key, context) != nullptr);
+            ASSERT(dict.Find(ObjectHolder::Own(ClassInstance(plain)), context) == nullptr);
+        }
+
+        void TestInstancesArePackedIntoSlabs() {
+            Class cls{ "Node"s, {}, nullptr };
+            std::vector<ObjectHolder> nodes;
+            for (int i = 0; i < 1000; ++i) {
+                nodes.push_back(ObjectHolder::Own(ClassInstance{ cls }));
+            }
+            SlabStats stats = cls.GetInstanceStats();
+            ASSERT(stats.slot_size >= sizeof(ClassInstance));
+            ASSERT_EQUAL(stats.allocations, 1000u);
+            ASSERT_EQUAL(stats.occupied_slots, 1000u);
+            const size_t slots_per_slab = SlabPool::SLAB_SIZE / stats.slot_size;
+            ASSERT(stats.slabs <= 1000 / (slots_per_slab - 1) + 1);
+
+            //     ,    
+            for (size_t i = 0; i < nodes.size(); i += 2) {
+                nodes[i] = ObjectHolder::Own(ClassInstance{ cls });
+            }
+            ASSERT_EQUAL(cls.GetInstanceStats().slabs_allocated, stats.slabs_allocated);
+
+            nodes.clear();
+            stats = cls.GetInstanceStats();
+            ASSERT_EQUAL(stats.occupied_slots, 0u);
+            //       
+            ASSERT_EQUAL(stats.slabs, 1u);
+            ObjectHolder again = ObjectHolder::Own(ClassInstance{ cls });
+            ASSERT_EQUAL(cls.GetInstanceStats().slabs_allocated, stats.slabs_allocated);
+        }
+
+        void TestInstancesOutliveTheirClass() {
+            auto cls = std::make_unique<Class>("Node"s, std::vector<Method>{}, nullptr);
+            ObjectHolder first = ObjectHolder::Own(ClassInstance{ *cls });
+            ObjectHolder second = ObjectHolder::Own(ClassInstance{ *cls });
+            first.TryAs<ClassInstance>()->SetField("next"s, second);
+            second = {};
+            //      ,      
+            cls.reset();
+            std::thread([node = std::move(first)]() mutable {
+                ASSERT(node.TryAs<ClassInstance>()->Fields().count("next"s) == 1);
+                node = {};
+            }).join();
+        }
+
     }  // namespace
 
     void RunObjectsTests(TestRunner& tr) {
         RUN_TEST(tr, runtime::TestNumber);
+        RUN_TEST(tr, runtime::TestFloat);
         RUN_TEST(tr, runtime::TestString);
         RUN_TEST(tr, runtime::TestBool);
         RUN_TEST(tr, runtime::TestMethodInvocation);
@@ -540,6 +850,16 @@ namespace runtime {
         RUN_TEST(tr, runtime::TestComparison);
         RUN_TEST(tr, runtime::TestClass);
         RUN_TEST(tr, runtime::TestClassInstance);
+        RUN_TEST(tr, runtime::TestExecutionBudget);
+        RUN_TEST(tr, runtime::TestFieldMapSwitchesToIndex);
+        RUN_TEST(tr, runtime::TestFieldMapCopyAndSwap);
+        RUN_TEST(tr, runtime::TestListStoresIntegersUnboxed);
+        RUN_TEST(tr, runtime::TestListSumOverflowsIntoBigInteger);
+        RUN_TEST(tr, runtime::TestListSortKeepsItemsOnError);
+        RUN_TEST(tr, runtime::TestDictGrowsAndErases);
+        RUN_TEST(tr, runtime::TestDictUsesHashAndEqMethods);
+        RUN_TEST(tr, runtime::TestInstancesArePackedIntoSlabs);
+        RUN_TEST(tr, runtime::TestInstancesOutliveTheirClass);
     }
 
     void RunObjectHolderTests(TestRunner& tr) {
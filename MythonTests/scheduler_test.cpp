@@ -0,0 +1,337 @@
+#include "interpreter.h"
+#include "lexer.h"
+#include "parse.h"
+#include "scheduler.h"
+#include "statement.h"
+
+#include "test_runner_p.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace executor {
+
+    namespace {
+        shared_ptr<runtime::Executable> ParseShared(const string& source) {
+            istringstream input(source);
+            parse::Lexer lexer(input);
+            return ParseProgram(lexer);
+        }
+
+        void TestStepwiseRunMatchesExecute() {
+            const string source = R"(
+class Counter:
+  def __init__():
+    self.value = 0
+
+  def add(n):
+    self.value = self.value + n
+
+c = Counter()
+c.add(2)
+if c.value > 1:
+  print 'big'
+  if c.value > 5:
+    print 'huge'
+  else:
+    c.add(10)
+    print 'now', c.value
+else:
+  print 'small'
+x = str(c.value) + '!'
+print x
+for i in range(5):
+  if i == 1:
+    continue
+  j = 0
+  while True:
+    j = j + 1
+    if j > i:
+      break
+  print i, j
+for k in {'a': 1, 'b': 2}:
+  for v in [k, k + k]:
+    print v
+)"s;
+            ostringstream expected;
+            {
+                istringstream input(source);
+                RunMythonProgram(input, expected);
+            }
+
+            ostringstream output;
+            ScriptRun script(ParseShared(source), {}, output);
+            size_t steps = 0;
+            size_t outputs = 0;
+            while (true) {
+                const auto result = script.Step();
+                ++steps;
+                if (result == ScriptRun::StepResult::Output) {
+                    ++outputs;
+                }
+                if (result == ScriptRun::StepResult::Finished) {
+                    break;
+                }
+            }
+            ASSERT(script.IsFinished());
+            ASSERT_EQUAL(output.str(), expected.str());
+            ASSERT(steps > 5u);
+            ASSERT_EQUAL(outputs, 11u);
+        }
+
+        void TestEmptyProgramFinishesImmediately() {
+            ostringstream output;
+            ScriptRun script(ParseShared(""s), {}, output);
+            ASSERT(script.IsFinished());
+            ASSERT(script.Step() == ScriptRun::StepResult::Finished);
+        }
+
+        void TestScriptsAreInterleaved() {
+            //             ,
+            //       
+            ostringstream output;
+            vector<Job> jobs(2);
+            jobs[0].program = ParseShared("print 'a1'\nprint 'a2'\nprint 'a3'\n"s);
+            jobs[1].program = ParseShared("print 'b1'\nprint 'b2'\n"s);
+            jobs[0].output = jobs[1].output = &output;
+
+            const auto report = CooperativeScheduler({ 1, 1, false }).Run(jobs);
+            ASSERT_EQUAL(report.FailedCount(), 0u);
+            ASSERT_EQUAL(output.str(), "a1\nb1\na2\nb2\na3\n"s);
+        }
+
+        void TestYieldOnOutput() {
+            ostringstream output;
+            vector<Job> jobs(2);
+            jobs[0].program = ParseShared("x = 1\nprint 'a', x\ny = 2\nprint 'a', y\n"s);
+            jobs[1].program = ParseShared("print 'b'\nprint 'b'\n"s);
+            jobs[0].output = jobs[1].output = &output;
+
+            const auto report = CooperativeScheduler({ 1, 100, true }).Run(jobs);
+            ASSERT_EQUAL(report.FailedCount(), 0u);
+            ASSERT_EQUAL(output.str(), "a 1\nb\na 2\nb\n"s);
+        }
+
+        void TestFuelSlicePreemptsScript() {
+            ostringstream output;
+            vector<Job> jobs(2);
+            jobs[0].program = ParseShared(R"(
+class Worker:
+  def tick():
+    self.inner()
+
+  def inner():
+    self.done = True
+
+w = Worker()
+w.tick()
+print 'a1'
+w.tick()
+print 'a2'
+)"s);
+            jobs[1].program = ParseShared("print 'b1'\nprint 'b2'\n"s);
+            jobs[0].output = jobs[1].output = &output;
+
+            //       
+            {
+                const auto report = CooperativeScheduler({ 1, 100, false }).Run(jobs);
+                ASSERT_EQUAL(report.FailedCount(), 0u);
+                ASSERT_EQUAL(output.str(), "a1\na2\nb1\nb2\n"s);
+                ASSERT_EQUAL(report.jobs[0].fuel_used, 5u);
+            }
+            output.str({});
+            //  w.tick()      ,    
+            {
+                const auto report = CooperativeScheduler({ 1, 100, false, 1 }).Run(jobs);
+                ASSERT_EQUAL(report.FailedCount(), 0u);
+                ASSERT_EQUAL(output.str(), "b1\nb2\na1\na2\n"s);
+            }
+            // Ƹ   
+            jobs[0].fuel_limit = 4;
+            {
+                const auto report = CooperativeScheduler({ 1, 100, false }).Run(jobs);
+                ASSERT(!report.jobs[0].ok);
+                ASSERT(report.jobs[1].ok);
+            }
+        }
+
+        void TestInfiniteLoopIsPreempted() {
+            ostringstream output;
+            vector<Job> jobs(2);
+            jobs[0].program = ParseShared(R"(
+i = 0
+while True:
+  i = i + 1
+  if i == 15:
+    print 'a'
+)"s);
+            jobs[0].fuel_limit = 100;
+            jobs[1].program = ParseShared("print 'b1'\nprint 'b2'\n"s);
+            jobs[0].output = jobs[1].output = &output;
+
+            //   -  ,        
+            const auto report = CooperativeScheduler({ 1, 1000, false, 10 }).Run(jobs);
+            ASSERT_EQUAL(output.str(), "b1\nb2\na\n"s);
+            ASSERT(!report.jobs[0].ok);
+            ASSERT_EQUAL(report.jobs[0].error, string(runtime::FuelExhausted().what()));
+            ASSERT(report.jobs[1].ok);
+            output.str({});
+
+            //        
+            jobs[0].program = ParseShared("for i in range(3):\n  print 'a', i\n"s);
+            jobs[0].fuel_limit = runtime::ExecutionBudget::UNLIMITED;
+            const auto yielding = CooperativeScheduler({ 1, 1000, true }).Run(jobs);
+            ASSERT_EQUAL(yielding.FailedCount(), 0u);
+            ASSERT_EQUAL(output.str(), "a 0\nb1\na 1\nb2\na 2\n"s);
+        }
+
+        void TestMethodCallIsOneStep() {
+            ostringstream output;
+            vector<Job> jobs(2);
+            jobs[0].program = ParseShared(R"(
+class Worker:
+  def run(n):
+    for i in range(n):
+      print 'a', i
+
+w = Worker()
+w.run(3)
+print 'a done'
+)"s);
+            jobs[1].program = ParseShared("print 'b1'\nprint 'b2'\n"s);
+            jobs[0].output = jobs[1].output = &output;
+
+            //   ,  print   :      
+            const auto report = CooperativeScheduler({ 1, 1000, true, 1 }).Run(jobs);
+            ASSERT_EQUAL(report.FailedCount(), 0u);
+            ASSERT_EQUAL(output.str(), "a 0\na 1\na 2\nb1\na done\nb2\n"s);
+            output.str({});
+
+            //        
+            jobs[0].program = ParseShared("class L:\n  def spin():\n    while True:\n      x = 1\n\nl = L()\nl.spin()\n"s);
+            jobs[0].fuel_limit = 1000;
+            const auto limited = CooperativeScheduler({ 1, 1000, true, 1 }).Run(jobs);
+            ASSERT(!limited.jobs[0].ok);
+            ASSERT_EQUAL(limited.jobs[0].fuel_used, 1001u);
+            ASSERT(limited.jobs[1].ok);
+            ASSERT_EQUAL(output.str(), "b1\nb2\n"s);
+        }
+
+        void TestMemoryLimitAbortsScript() {
+            //    s,     
+            string source = "s = 'abcdefgh'\n"s;
+            for (int i = 0; i < 24; ++i) {
+                source += "s = s + s\n"s;
+            }
+            ostringstream out[2];
+            vector<Job> jobs(2);
+            jobs[0].program = ParseShared(source);
+            jobs[0].output = &out[0];
+            jobs[0].memory_limit = 1 << 20;
+            jobs[1].program = ParseShared("x = 'small'\nprint x\n"s);
+            jobs[1].output = &out[1];
+            jobs[1].memory_stats = true;
+
+            const auto report = CooperativeScheduler({ 1, 4 }).Run(jobs);
+            ASSERT(!report.jobs[0].ok);
+            ASSERT_EQUAL(report.jobs[0].error, string(runtime::MemoryLimitExceeded().what()));
+            ASSERT(report.jobs[0].memory.peak_bytes <= (1u << 20));
+            ASSERT(report.jobs[0].memory.peak_bytes >= (1u << 18));
+            ASSERT(report.jobs[1].ok);
+            ASSERT_EQUAL(out[1].str(), "small\n"s);
+            ASSERT(report.jobs[1].memory.live_bytes > 0);
+        }
+
+        void TestScriptReleasesItsMemory() {
+            ostringstream output;
+            auto account = make_shared<runtime::MemoryAccount>();
+            {
+                ScriptRun script(ParseShared(R"(
+s = 'a rather long string that does not fit into the short string buffer'
+items = [s, s + s]
+for i in range(3):
+  t = s + s
+)"s), {}, output, runtime::ExecutionBudget::UNLIMITED, account);
+                while (script.Step() != ScriptRun::StepResult::Finished) {
+                }
+                ASSERT(account->GetStats().live_bytes > 0);
+            }
+            //        
+            ASSERT_EQUAL(account->GetStats().live_bytes, 0u);
+        }
+
+        void TestScriptCyclesAreCollected() {
+            ostringstream output;
+            auto account = make_shared<runtime::MemoryAccount>();
+            {
+                ScriptRun script(ParseShared(R"(
+class Node:
+  def __init__():
+    self.me = self
+
+for i in range(1000):
+  n = Node()
+)"s), {}, output, runtime::ExecutionBudget::UNLIMITED, account);
+                while (script.Step() != ScriptRun::StepResult::Finished) {
+                }
+            }
+            //     ,       
+            ASSERT_EQUAL(account->GetStats().live_bytes, 0u);
+            ASSERT_EQUAL(account->GetStats()[runtime::MemoryKind::Instance].allocations, 1000u);
+        }
+
+        void TestManyConcurrentScripts() {
+            auto program = ParseShared(R"(
+total = n
+total = total + 1
+if total > 500:
+  label = 'upper'
+else:
+  label = 'lower'
+total = total * 2
+print label, total
+)"s);
+
+            const int job_count = 1000;
+            vector<ostringstream> outputs(job_count);
+            vector<Job> jobs(job_count);
+            for (int i = 0; i < job_count; ++i) {
+                jobs[i].program = program;
+                jobs[i].input["n"s] = runtime::ObjectHolder::Own(runtime::Number(i));
+                jobs[i].output = &outputs[i];
+            }
+            //      
+            jobs[7].input.clear();
+
+            const auto report = CooperativeScheduler({ 4, 2, false }).Run(jobs);
+            ASSERT_EQUAL(report.jobs.size(), static_cast<size_t>(job_count));
+            ASSERT_EQUAL(report.FailedCount(), 1u);
+            ASSERT(!report.jobs[7].ok);
+            for (int i = 0; i < job_count; ++i) {
+                if (i == 7) {
+                    continue;
+                }
+                ASSERT(report.jobs[i].ok);
+                ASSERT_EQUAL(outputs[i].str(), (i + 1 > 500 ? "upper "s : "lower "s) + to_string((i + 1) * 2) + "\n"s);
+            }
+        }
+    }  // namespace
+
+    void RunSchedulerTests(TestRunner& tr) {
+        RUN_TEST(tr, executor::TestStepwiseRunMatchesExecute);
+        RUN_TEST(tr, executor::TestEmptyProgramFinishesImmediately);
+        RUN_TEST(tr, executor::TestScriptsAreInterleaved);
+        RUN_TEST(tr, executor::TestYieldOnOutput);
+        RUN_TEST(tr, executor::TestFuelSlicePreemptsScript);
+        RUN_TEST(tr, executor::TestInfiniteLoopIsPreempted);
+        RUN_TEST(tr, executor::TestMethodCallIsOneStep);
+        RUN_TEST(tr, executor::TestMemoryLimitAbortsScript);
+        RUN_TEST(tr, executor::TestScriptReleasesItsMemory);
+        RUN_TEST(tr, executor::TestScriptCyclesAreCollected);
+        RUN_TEST(tr, executor::TestManyConcurrentScripts);
+    }
+
+}  // namespace executor
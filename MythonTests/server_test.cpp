@@ -0,0 +1,158 @@
+#include "load_client.h"
+#include "server.h"
+
+#include "test_runner_p.h"
+
+#include <string>
+
+using namespace std;
+
+namespace server {
+
+    namespace {
+
+        const string SOCKET_PATH = "mython_server_test.sock"s;
+
+        void TestExecutesProgramsOverSocket() {
+            Server server(SOCKET_PATH, { 2 });
+            server.Start();
+
+            Client client(SOCKET_PATH);
+            Response response = client.Execute("x = stdin + '!'\nprint 'got', x\n"sv, "hello"sv);
+            ASSERT(response.ok);
+            ASSERT_EQUAL(response.output, "got hello!\n"s);
+
+            //     
+            response = client.Execute("print 'before'\nprint 1 + 'a'\n"sv);
+            ASSERT(!response.ok);
+            ASSERT_EQUAL(response.output, "before\n"s);
+            ASSERT(!response.error.empty());
+
+            response = client.Execute("print (\n"sv);
+            ASSERT(!response.ok);
+
+            response = client.Execute("x = stdin + '!'\nprint 'got', x\n"sv, "again"sv);
+            ASSERT(response.ok);
+            ASSERT_EQUAL(response.output, "got again!\n"s);
+
+            ASSERT_EQUAL(server.GetRequestCount(), 4u);
+            ASSERT_EQUAL(server.GetCache().GetHits(), 1u);
+        }
+
+        void TestStreamsLargeOutput() {
+            ServerOptions options;
+            options.thread_count = 1;
+            options.output_chunk_size = 16;
+            Server server(SOCKET_PATH, options);
+            server.Start();
+
+            string program;
+            string expected;
+            for (int i = 0; i < 100; ++i) {
+                program += "print 'line', "s + to_string(i) + "\n"s;
+                expected += "line "s + to_string(i) + "\n"s;
+            }
+            Client client(SOCKET_PATH);
+            const Response response = client.Execute(program);
+            ASSERT(response.ok);
+            ASSERT_EQUAL(response.output, expected);
+        }
+
+        void TestFuelLimitAbortsRunawayProgram() {
+            ServerOptions options;
+            options.thread_count = 1;
+            options.fuel_limit = 200;
+            Server server(SOCKET_PATH, options);
+            server.Start();
+
+            Client client(SOCKET_PATH);
+            const Response response = client.Execute(R"(
+class Loop:
+  def spin():
+    self.spin()
+
+l = Loop()
+l.spin()
+)"sv);
+            ASSERT(!response.ok);
+            ASSERT_EQUAL(response.error, string(runtime::FuelExhausted().what()));
+            ASSERT(client.Execute("print 'alive'\n"sv).ok);
+        }
+
+        void TestOversizedFrameIsRejected() {
+            ServerOptions options;
+            options.thread_count = 1;
+            options.max_frame_bytes = 64;
+            Server server(SOCKET_PATH, options);
+            server.Start();
+
+            //   4  ,   
+            net::LocalSocket socket = net::LocalSocket::Connect(SOCKET_PATH);
+            const char header[5] = { static_cast<char>(net::FrameType::Program), '\xFF', '\xFF', '\xFF', '\xFF' };
+            socket.SendAll({ header, sizeof(header) });
+            net::FrameType type;
+            string data;
+            ASSERT(net::ReceiveFrame(socket, type, data));
+            ASSERT(type == net::FrameType::Error);
+            ASSERT(data.find("exceeds the limit of 64"s) != string::npos);
+            ASSERT(!net::ReceiveFrame(socket, type, data));
+
+            //       
+            Client client(SOCKET_PATH);
+            ASSERT(client.Execute("print 'ok'\n"sv).ok);
+            ASSERT(!client.Execute(string(100, ' ')).ok);
+        }
+
+        void TestLoadGenerator() {
+            Server server(SOCKET_PATH, { 4 });
+            server.Start();
+
+            LoadOptions options;
+            options.socket_path = SOCKET_PATH;
+            options.program = "print stdin\n"s;
+            options.input = "payload"s;
+            options.connections = 4;
+            options.requests = 200;
+            const LoadReport report = RunLoad(options);
+
+            ASSERT_EQUAL(report.failed, 0u);
+            ASSERT_EQUAL(report.latencies.GetCount(), 200u);
+            ASSERT(report.Throughput() > 0);
+            ASSERT_EQUAL(server.GetRequestCount(), 200u);
+            ASSERT_EQUAL(server.GetCache().GetMisses() + server.GetCache().GetHits(), 200u);
+        }
+
+        void TestLatencyHistogram() {
+            LatencyHistogram histogram;
+            for (int i = 1; i <= 1000; ++i) {
+                histogram.Record(chrono::microseconds(i));
+            }
+            ASSERT_EQUAL(histogram.GetCount(), 1000u);
+            ASSERT(histogram.GetMax() == chrono::microseconds(1000));
+
+            //       (1/8 )
+            const auto p50 = chrono::duration_cast<chrono::microseconds>(histogram.Percentile(0.5)).count();
+            ASSERT(p50 >= 500 && p50 <= 500 + 500 / 8 + 1);
+            const auto p99 = chrono::duration_cast<chrono::microseconds>(histogram.Percentile(0.99)).count();
+            ASSERT(p99 >= 990 && p99 <= 1000);
+            ASSERT(histogram.Percentile(1.0) == histogram.GetMax());
+
+            LatencyHistogram other;
+            other.Record(chrono::milliseconds(50));
+            histogram.Merge(other);
+            ASSERT_EQUAL(histogram.GetCount(), 1001u);
+            ASSERT(histogram.GetMax() == chrono::milliseconds(50));
+        }
+
+    }  // namespace
+
+    void RunServerTests(TestRunner& tr) {
+        RUN_TEST(tr, server::TestExecutesProgramsOverSocket);
+        RUN_TEST(tr, server::TestStreamsLargeOutput);
+        RUN_TEST(tr, server::TestFuelLimitAbortsRunawayProgram);
+        RUN_TEST(tr, server::TestOversizedFrameIsRejected);
+        RUN_TEST(tr, server::TestLoadGenerator);
+        RUN_TEST(tr, server::TestLatencyHistogram);
+    }
+
+}  // namespace server
@@ -0,0 +1,151 @@
+#include "cycle_collector.h"
+#include "lexer.h"
+#include "memory_account.h"
+#include "snapshot.h"
+
+#include "test_runner_p.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+namespace {
+
+    const string PRELUDE = R"(
+class Counter:
+  def __init__():
+    self.value = 0
+
+  def add(n):
+    self.value = self.value + n
+
+class NamedCounter(Counter):
+  def __str__():
+    return self.name
+
+counter = NamedCounter()
+counter.name = 'main'
+alias = counter
+holder = Counter()
+holder.inner = counter
+greeting = 'hello'
+print 'prelude done'
+)"s;
+
+    string RunRequest(const PreludeSnapshot& snapshot, const string& source) {
+        istringstream input(source);
+        ostringstream output;
+        runtime::SimpleContext context{ output };
+        snapshot.Run(input, context);
+        return output.str();
+    }
+
+    void TestRequestsSeePreludeState() {
+        istringstream prelude(PRELUDE);
+        ostringstream prelude_output;
+        auto snapshot = PreludeSnapshot::Create(prelude, prelude_output);
+        ASSERT_EQUAL(prelude_output.str(), "prelude done\n"s);
+
+        ASSERT_EQUAL(RunRequest(*snapshot, "counter.add(5)\nprint counter, counter.value, greeting\n"s),
+            "main 5 hello\n"s);
+        //        
+        ASSERT_EQUAL(RunRequest(*snapshot, R"(
+class Twice(Counter):
+  def add(n):
+    self.value = self.value + n * 2
+
+t = Twice()
+t.add(4)
+n = NamedCounter()
+n.name = 'fresh'
+print t.value, n
+)"s), "8 fresh\n"s);
+    }
+
+    void TestRequestsAreIsolated() {
+        istringstream prelude(PRELUDE);
+        ostringstream prelude_output;
+        auto snapshot = PreludeSnapshot::Create(prelude, prelude_output);
+
+        ASSERT_EQUAL(RunRequest(*snapshot, "counter.add(7)\ngreeting = 'bye'\nprint counter.value\n"s), "7\n"s);
+        ASSERT_EQUAL(RunRequest(*snapshot, "print counter.value, greeting\n"s), "0 hello\n"s);
+
+        const auto& globals = snapshot->GetGlobals();
+        ASSERT_EQUAL(globals.at("counter"s).TryAs<runtime::ClassInstance>()->Fields().at("value"s).TryAs<runtime::Number>()->GetValue(), 0);
+    }
+
+    void TestCloneSharesImmutableStateAndKeepsAliases() {
+        istringstream prelude(PRELUDE);
+        ostringstream prelude_output;
+        auto snapshot = PreludeSnapshot::Create(prelude, prelude_output);
+        const auto& globals = snapshot->GetGlobals();
+
+        runtime::Closure clone = snapshot->Clone();
+        ASSERT_EQUAL(clone.size(), globals.size());
+        ASSERT(clone.at("Counter"s).Get() == globals.at("Counter"s).Get());
+        ASSERT(clone.at("greeting"s).Get() == globals.at("greeting"s).Get());
+        ASSERT(clone.at("counter"s).Get() != globals.at("counter"s).Get());
+
+        //      
+        ASSERT(clone.at("alias"s).Get() == clone.at("counter"s).Get());
+        auto* holder = clone.at("holder"s).TryAs<runtime::ClassInstance>();
+        ASSERT(holder->Fields().at("inner"s).Get() == clone.at("counter"s).Get());
+    }
+
+    void TestCloneIsAccountedAndCollected() {
+        istringstream prelude(R"(
+class Node:
+  def __init__():
+    self.partner_of_this_node = None
+
+a = Node()
+b = Node()
+a.partner_of_this_node = b
+b.partner_of_this_node = a
+)"s);
+        ostringstream prelude_output;
+        auto snapshot = PreludeSnapshot::Create(prelude, prelude_output);
+
+        auto account = make_shared<runtime::MemoryAccount>();
+        {
+            const runtime::MemoryAccount::Scope scope(account);
+            runtime::CycleCollector collector;
+            {
+                runtime::Closure clone = snapshot->Clone(&collector);
+                ASSERT_EQUAL(collector.GetTrackedCount(), 2u);
+                //        
+                ASSERT(account->GetStats()[runtime::MemoryKind::Closure].live_bytes > 0);
+            }
+            //     ,     
+            ASSERT(account->GetStats().live_bytes > 0);
+            ASSERT_EQUAL(collector.Collect(), 2u);
+        }
+        ASSERT_EQUAL(account->GetStats().live_bytes, 0u);
+
+        //       
+        weak_ptr<runtime::Object> original = snapshot->GetGlobals().at("a"s).GetWeakPtr();
+        snapshot.reset();
+        ASSERT(original.expired());
+    }
+
+    void TestRequestCannotRedefinePreludeClass() {
+        istringstream prelude(PRELUDE);
+        ostringstream prelude_output;
+        auto snapshot = PreludeSnapshot::Create(prelude, prelude_output);
+
+        istringstream input("class Counter:\n  def f():\n    return 1\n"s);
+        parse::Lexer lexer(input);
+        ASSERT_THROWS((void)snapshot->Parse(lexer), ParseError);
+    }
+
+}  // namespace
+
+void RunSnapshotTests(TestRunner& tr) {
+    RUN_TEST(tr, TestRequestsSeePreludeState);
+    RUN_TEST(tr, TestRequestsAreIsolated);
+    RUN_TEST(tr, TestCloneSharesImmutableStateAndKeepsAliases);
+    RUN_TEST(tr, TestCloneIsAccountedAndCollected);
+    RUN_TEST(tr, TestRequestCannotRedefinePreludeClass);
+}
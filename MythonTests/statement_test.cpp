@@ -107,6 +107,23 @@ namespace ast {
             ASSERT(context.output.str().empty());
         }
 
+        void TestNewInstanceIsCreatedOnEachExecution() {
+            runtime::DummyContext context;
+
+            runtime::Class empty("Empty"s, {}, nullptr);
+            NewInstance new_instance(empty);
+            Closure closure;
+
+            ObjectHolder first = new_instance.Execute(closure, context);
+            ObjectHolder second = new_instance.Execute(closure, context);
+            ASSERT(first.TryAs<runtime::ClassInstance>() != nullptr);
+            ASSERT(second.TryAs<runtime::ClassInstance>() != nullptr);
+            ASSERT(first.Get() != second.Get());
+
+            first.TryAs<runtime::ClassInstance>()->Fields()["x"s] = ObjectHolder::Own(runtime::Number(1));
+            ASSERT(second.TryAs<runtime::ClassInstance>()->Fields().empty());
+        }
+
         void TestFieldAssignment() {
             runtime::DummyContext context;
 
@@ -216,6 +233,57 @@ namespace ast {
             ASSERT(context.output.str().empty());
         }
 
+        //     ,    
+        class CountingStatement : public Statement {
+        public:
+            CountingStatement(ObjectHolder value, int& counter)
+                : value_(std::move(value))
+                , counter_(counter) {
+            }
+
+            ObjectHolder Execute(Closure& /*closure*/, runtime::Context& /*context*/) override {
+                ++counter_;
+                return value_;
+            }
+
+        private:
+            ObjectHolder value_;
+            int& counter_;
+        };
+
+        void TestStringifyEvaluatesArgumentOnce() {
+            runtime::DummyContext context;
+            Closure empty;
+
+            for (auto value : { ObjectHolder::Own(runtime::Number(5)), ObjectHolder::Own(runtime::String("s"s)),
+                     ObjectHolder::Own(runtime::Bool(true)), ObjectHolder::None() }) {
+                int counter = 0;
+                Stringify(make_unique<CountingStatement>(value, counter)).Execute(empty, context);
+                ASSERT_EQUAL(counter, 1);
+            }
+        }
+
+        void TestStringifyReusesObjects() {
+            runtime::DummyContext context;
+            Closure empty;
+
+            ObjectHolder text = ObjectHolder::Own(runtime::String("log line"s));
+            int counter = 0;
+            ASSERT(Stringify(make_unique<CountingStatement>(text, counter)).Execute(empty, context).Get() == text.Get());
+
+            auto true_str = Stringify(make_unique<BoolConst>(runtime::Bool(true))).Execute(empty, context);
+            ASSERT_OBJECT_VALUE_EQUAL(true_str, "True"s);
+            ASSERT(Stringify(make_unique<BoolConst>(runtime::Bool(true))).Execute(empty, context).Get() == true_str.Get());
+
+            auto false_str = Stringify(make_unique<BoolConst>(runtime::Bool(false))).Execute(empty, context);
+            ASSERT_OBJECT_VALUE_EQUAL(false_str, "False"s);
+            ASSERT(false_str.Get() != true_str.Get());
+
+            auto none_str = Stringify(make_unique<None>()).Execute(empty, context);
+            ASSERT(none_str.TryAs<runtime::String>());
+            ASSERT(Stringify(make_unique<None>()).Execute(empty, context).Get() == none_str.Get());
+        }
+
         void TestNumbersAddition() {
             runtime::DummyContext context;
 
@@ -257,6 +325,120 @@ namespace ast {
             ASSERT(context.output.str().empty());
         }
 
+        void TestIntegerOverflowSwitchesToBigInteger() {
+            runtime::DummyContext context;
+            Closure empty;
+
+            // 2^62 + 2^62     int64_t
+            const int64_t half = int64_t{ 1 } << 62;
+            auto sum = Add(make_unique<NumericConst>(half), make_unique<NumericConst>(half)).Execute(empty, context);
+            ASSERT(sum.TryAs<runtime::BigNumber>() != nullptr);
+            ASSERT_OBJECT_VALUE_EQUAL(sum, "9223372036854775808"s);
+
+            auto product = Mult(make_unique<NumericConst>(numeric_limits<int64_t>::max()),
+                                make_unique<NumericConst>(numeric_limits<int64_t>::max()))
+                               .Execute(empty, context);
+            ASSERT_OBJECT_VALUE_EQUAL(product, "85070591730234615847396907784232501249"s);
+
+            auto difference = Sub(make_unique<NumericConst>(numeric_limits<int64_t>::min()),
+                                  make_unique<NumericConst>(1))
+                                  .Execute(empty, context);
+            ASSERT_OBJECT_VALUE_EQUAL(difference, "-9223372036854775809"s);
+
+            //   
+            auto quotient = Div(make_unique<NumericConst>(numeric_limits<int64_t>::min()),
+                                make_unique<NumericConst>(-1))
+                                .Execute(empty, context);
+            ASSERT_OBJECT_VALUE_EQUAL(quotient, "9223372036854775808"s);
+
+            ASSERT(context.output.str().empty());
+        }
+
+        void TestBigIntegerShrinksBackToNumber() {
+            runtime::DummyContext context;
+
+            Closure closure;
+            closure["big"s] = Mult(make_unique<NumericConst>(int64_t{ 1 } << 40), make_unique<NumericConst>(int64_t{ 1 } << 40))
+                                  .Execute(closure, context);
+            ASSERT(closure.at("big"s).TryAs<runtime::BigNumber>() != nullptr);
+
+            auto small = Div(make_unique<VariableValue>("big"s), make_unique<NumericConst>(int64_t{ 1 } << 30))
+                             .Execute(closure, context);
+            ASSERT(small.TryAs<runtime::Number>() != nullptr);
+            ASSERT_EQUAL(small.TryAs<runtime::Number>()->GetValue(), int64_t{ 1 } << 50);
+
+            auto zero = Sub(make_unique<VariableValue>("big"s), make_unique<VariableValue>("big"s)).Execute(closure, context);
+            ASSERT(zero.TryAs<runtime::Number>() != nullptr);
+            ASSERT(!runtime::IsTrue(zero));
+            ASSERT(runtime::IsTrue(closure.at("big"s)));
+
+            //  
+            auto number = ObjectHolder::Own(runtime::Number(numeric_limits<int64_t>::max()));
+            ASSERT(runtime::Less(number, closure.at("big"s), context));
+            ASSERT(!runtime::Equal(number, closure.at("big"s), context));
+            ASSERT(runtime::Equal(closure.at("big"s), closure.at("big"s), context));
+
+            ASSERT(context.output.str().empty());
+        }
+
+        void TestIntegerDivision() {
+            runtime::DummyContext context;
+            Closure empty;
+
+            //    ,   
+            ASSERT_OBJECT_VALUE_EQUAL(Div(make_unique<NumericConst>(7), make_unique<NumericConst>(2)).Execute(empty, context), 3);
+            ASSERT_OBJECT_VALUE_EQUAL(Div(make_unique<NumericConst>(-7), make_unique<NumericConst>(2)).Execute(empty, context), -3);
+
+            ASSERT_THROWS(Div(make_unique<NumericConst>(1), make_unique<NumericConst>(0)).Execute(empty, context),
+                          std::runtime_error);
+            Closure closure;
+            closure["big"s] = Mult(make_unique<NumericConst>(int64_t{ 1 } << 40), make_unique<NumericConst>(int64_t{ 1 } << 40))
+                                  .Execute(closure, context);
+            ASSERT_THROWS(Div(make_unique<VariableValue>("big"s), make_unique<NumericConst>(0)).Execute(closure, context),
+                          std::runtime_error);
+            ASSERT_OBJECT_VALUE_EQUAL(
+                Div(make_unique<VariableValue>("big"s), make_unique<NumericConst>(-3)).Execute(closure, context),
+                "-402975273204876391568725"s);
+
+            ASSERT(context.output.str().empty());
+        }
+
+        void TestFloatArithmetic() {
+            runtime::DummyContext context;
+            Closure empty;
+
+            auto sum = Add(make_unique<FloatConst>(1.5), make_unique<FloatConst>(2.25)).Execute(empty, context);
+            ASSERT(sum.TryAs<runtime::Float>() != nullptr);
+            ASSERT_EQUAL(sum.TryAs<runtime::Float>()->GetValue(), 3.75);
+
+            //     double   
+            auto product = Mult(make_unique<NumericConst>(3), make_unique<FloatConst>(0.5)).Execute(empty, context);
+            ASSERT_EQUAL(product.TryAs<runtime::Float>()->GetValue(), 1.5);
+            auto difference = Sub(make_unique<FloatConst>(0.5), make_unique<NumericConst>(2)).Execute(empty, context);
+            ASSERT_EQUAL(difference.TryAs<runtime::Float>()->GetValue(), -1.5);
+
+            //   Float    ,   - - 
+            auto quotient = Div(make_unique<NumericConst>(7), make_unique<FloatConst>(2.0)).Execute(empty, context);
+            ASSERT_EQUAL(quotient.TryAs<runtime::Float>()->GetValue(), 3.5);
+            ASSERT(Div(make_unique<NumericConst>(7), make_unique<NumericConst>(2)).Execute(empty, context).TryAs<runtime::Number>());
+            ASSERT_THROWS(Div(make_unique<FloatConst>(1.0), make_unique<FloatConst>(0.0)).Execute(empty, context),
+                          std::runtime_error);
+            ASSERT_THROWS(Div(make_unique<FloatConst>(1.0), make_unique<NumericConst>(0)).Execute(empty, context),
+                          std::runtime_error);
+
+            ASSERT_THROWS(Add(make_unique<FloatConst>(1.0), make_unique<StringConst>("1"s)).Execute(empty, context),
+                          std::runtime_error);
+
+            auto half = ObjectHolder::Own(runtime::Float(0.5));
+            auto one = ObjectHolder::Own(runtime::Number(1));
+            ASSERT(runtime::Less(half, one, context));
+            ASSERT(runtime::Equal(ObjectHolder::Own(runtime::Float(1.0)), one, context));
+            ASSERT(!runtime::IsTrue(ObjectHolder::Own(runtime::Float(0.0))));
+            ASSERT(runtime::IsTrue(half));
+
+            ASSERT(context.output.str().empty());
+        }
+
         void TestSuccessfulClassInstanceAdd() {
             runtime::DummyContext context;
 
@@ -309,6 +491,69 @@ namespace ast {
             ASSERT(context.output.str().empty());
         }
 
+        //    i   
+        struct RecordVariable : Statement {
+            vector<ObjectHolder> values;
+
+            ObjectHolder Execute(Closure& closure, [[maybe_unused]] runtime::Context& context) override {
+                values.push_back(closure.at("i"s));
+                return {};
+            }
+        };
+
+        void TestForRangeReusesCounter() {
+            runtime::DummyContext context;
+            Closure closure;
+            //    i,         
+            ForRange silent("i"s, nullptr, make_unique<NumericConst>(1000), nullptr, make_unique<Compound>());
+            silent.Execute(closure, context);
+            ASSERT_OBJECT_VALUE_EQUAL(closure.at("i"s), 999);
+            const runtime::Object* counter = closure.at("i"s).Get();
+            silent.Execute(closure, context);
+            ASSERT_EQUAL(closure.at("i"s).Get(), counter);
+
+            // ,  ,     
+            auto record = make_unique<RecordVariable>();
+            RecordVariable& recorded = *record;
+            ForRange loop("i"s, make_unique<NumericConst>(5), make_unique<NumericConst>(-1),
+                make_unique<NumericConst>(-2), std::move(record));
+            loop.Execute(closure, context);
+            ASSERT_EQUAL(recorded.values.size(), 3u);
+            ASSERT_OBJECT_VALUE_EQUAL(recorded.values[0], 5);
+            ASSERT_OBJECT_VALUE_EQUAL(recorded.values[1], 3);
+            ASSERT_OBJECT_VALUE_EQUAL(recorded.values[2], 1);
+
+            ForRange zero_step("i"s, nullptr, make_unique<NumericConst>(3), make_unique<NumericConst>(0),
+                make_unique<Compound>());
+            ASSERT_THROWS(zero_step.Execute(closure, context), runtime_error);
+        }
+
+        void TestLoopsChargeFuel() {
+            runtime::DummyContext context;
+            runtime::ExecutionBudget budget(1000);
+            context.SetBudget(&budget);
+            Closure closure;
+            While forever(make_unique<BoolConst>(runtime::Bool(true)), make_unique<Compound>());
+            ASSERT_THROWS(forever.Execute(closure, context), runtime::FuelExhausted);
+        }
+
+        void TestBreakLeavesNestedStatements() {
+            runtime::DummyContext context;
+            Closure closure;
+            // break  continue       if
+            Compound body{
+                make_unique<IfElse>(make_unique<BoolConst>(runtime::Bool(true)),
+                    make_unique<Compound>(make_unique<Compound>(make_unique<Break>())), nullptr),
+                make_unique<Print>(make_unique<StringConst>("unreachable"s)),
+            };
+            ASSERT(body.Execute(closure, context));
+            While once(make_unique<BoolConst>(runtime::Bool(true)), make_unique<Compound>(
+                make_unique<IfElse>(make_unique<BoolConst>(runtime::Bool(true)), make_unique<Break>(), nullptr),
+                make_unique<Print>(make_unique<StringConst>("unreachable"s))));
+            ASSERT(!once.Execute(closure, context));
+            ASSERT(context.output.str().empty());
+        }
+
         void TestFields() {
             runtime::DummyContext context;
 
@@ -462,15 +707,25 @@ namespace ast {
         RUN_TEST(tr, ast::TestVariable);
         RUN_TEST(tr, ast::TestAssignment);
         RUN_TEST(tr, ast::TestFieldAssignment);
+        RUN_TEST(tr, ast::TestNewInstanceIsCreatedOnEachExecution);
         RUN_TEST(tr, ast::TestPrintVariable);
         RUN_TEST(tr, ast::TestPrintMultipleStatements);
         RUN_TEST(tr, ast::TestStringify);
+        RUN_TEST(tr, ast::TestStringifyEvaluatesArgumentOnce);
+        RUN_TEST(tr, ast::TestStringifyReusesObjects);
         RUN_TEST(tr, ast::TestNumbersAddition);
         RUN_TEST(tr, ast::TestStringsAddition);
         RUN_TEST(tr, ast::TestBadAddition);
+        RUN_TEST(tr, ast::TestIntegerOverflowSwitchesToBigInteger);
+        RUN_TEST(tr, ast::TestBigIntegerShrinksBackToNumber);
+        RUN_TEST(tr, ast::TestIntegerDivision);
+        RUN_TEST(tr, ast::TestFloatArithmetic);
         RUN_TEST(tr, ast::TestSuccessfulClassInstanceAdd);
         RUN_TEST(tr, ast::TestClassInstanceAddWithoutMethod);
         RUN_TEST(tr, ast::TestCompound);
+        RUN_TEST(tr, ast::TestForRangeReusesCounter);
+        RUN_TEST(tr, ast::TestLoopsChargeFuel);
+        RUN_TEST(tr, ast::TestBreakLeavesNestedStatements);
         RUN_TEST(tr, ast::TestFields);
         RUN_TEST(tr, ast::TestBaseClass);
         RUN_TEST(tr, ast::TestInheritance);
@@ -0,0 +1,63 @@
+#include "test_runner_p.h"
+
+#include <iostream>
+
+using namespace std;
+
+namespace parse {
+    void RunOpenLexerTests(TestRunner& tr);
+    void RunParallelLexerTests(TestRunner& tr);
+}  // namespace parse
+
+namespace ast {
+    void RunUnitTests(TestRunner& tr);
+}
+namespace runtime {
+    void RunObjectHolderTests(TestRunner& tr);
+    void RunObjectsTests(TestRunner& tr);
+    void RunAsyncOutputTests(TestRunner& tr);
+    void RunCycleCollectorTests(TestRunner& tr);
+    void RunMemoryAccountTests(TestRunner& tr);
+    void RunHeapSnapshotTests(TestRunner& tr);
+    void RunFrameStackTests(TestRunner& tr);
+}  // namespace runtime
+
+namespace executor {
+    void RunExecutorTests(TestRunner& tr);
+    void RunSchedulerTests(TestRunner& tr);
+}
+
+namespace server {
+    void RunServerTests(TestRunner& tr);
+}
+
+void TestParseProgram(TestRunner& tr);
+void RunInterpreterTests(TestRunner& tr);
+void RunSnapshotTests(TestRunner& tr);
+
+int main() {
+    try {
+        TestRunner tr;
+        parse::RunOpenLexerTests(tr);
+        parse::RunParallelLexerTests(tr);
+        runtime::RunObjectHolderTests(tr);
+        runtime::RunObjectsTests(tr);
+        ast::RunUnitTests(tr);
+        TestParseProgram(tr);
+        RunInterpreterTests(tr);
+        executor::RunExecutorTests(tr);
+        runtime::RunAsyncOutputTests(tr);
+        executor::RunSchedulerTests(tr);
+        RunSnapshotTests(tr);
+        server::RunServerTests(tr);
+        runtime::RunCycleCollectorTests(tr);
+        runtime::RunMemoryAccountTests(tr);
+        runtime::RunHeapSnapshotTests(tr);
+        runtime::RunFrameStackTests(tr);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}